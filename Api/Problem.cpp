@@ -366,6 +366,9 @@ public:
     ASS_EQ(obj->_forms, 0);
 
     obj->_forms = AFList::copy(_forms);
+    obj->_size = _size;
+    obj->_scopeUnits = _scopeUnits;
+    obj->_scopeStarts = _scopeStarts;
   }
 
   void addFormula(AnnotatedFormula f)
@@ -374,8 +377,58 @@ public:
 
     _size++;
     AFList::push(f, _forms);
+    if(_scopeStarts.isNonEmpty()) {
+      _scopeUnits.push(f.unit);
+    }
+  }
+
+  void push()
+  {
+    CALL("Problem::PData::push");
+
+    _scopeStarts.push(_scopeUnits.size());
   }
 
+  /**
+   * Remove formulas added since the last call to push()
+   *
+   * Formulas are kept newest-first, so the formulas of the innermost
+   * scope are the first occurrences of their units in the list. We
+   * only walk the list until all of them have been removed.
+   */
+  void pop()
+  {
+    CALL("Problem::PData::pop");
+    ASS(_scopeStarts.isNonEmpty());
+
+    size_t start = _scopeStarts.pop();
+    size_t remaining = _scopeUnits.size()-start;
+    if(!remaining) {
+      return;
+    }
+
+    DHMap<Kernel::Unit*,unsigned> toRemove;
+    while(_scopeUnits.size()>start) {
+      unsigned* pCnt;
+      toRemove.getValuePtr(_scopeUnits.pop(), pCnt, 0);
+      (*pCnt)++;
+    }
+
+    AFList::DelIterator fit(_forms);
+    while(remaining && fit.hasNext()) {
+      unsigned* pCnt = toRemove.findPtr(fit.next().unit);
+      if(!pCnt || !*pCnt) {
+        continue;
+      }
+      (*pCnt)--;
+      remaining--;
+      fit.del();
+      _size--;
+    }
+  }
+
+  unsigned scopeDepth() { return _scopeStarts.size(); }
+
   size_t size() { return _size; }
 
   AFList*& forms() { return _forms; }
@@ -397,6 +450,11 @@ private:
   size_t _size;
   AFList* _forms;
   unsigned _refCnt;
+
+  /** Units added while some scope was open, oldest first */
+  Stack<Kernel::Unit*> _scopeUnits;
+  /** For each open scope, the size of _scopeUnits when it was opened */
+  Stack<size_t> _scopeStarts;
 };
 
 
@@ -453,6 +511,30 @@ void Problem::addFormula(AnnotatedFormula f)
   _data->addFormula(f);
 }
 
+void Problem::push()
+{
+  CALL("Problem::push");
+
+  _data->push();
+}
+
+void Problem::pop()
+{
+  CALL("Problem::pop");
+
+  if(!_data->scopeDepth()) {
+    throw ApiException("Problem::pop() called with no open scope");
+  }
+  _data->pop();
+}
+
+unsigned Problem::scopeDepth()
+{
+  CALL("Problem::scopeDepth");
+
+  return _data->scopeDepth();
+}
+
 size_t Problem::size()
 {
   CALL("Problem::size");
@@ -413,6 +413,33 @@ public:
    */
   void addFormula(AnnotatedFormula f);
 
+  /**
+   * Open a new assertion scope
+   *
+   * Formulas added to the problem after this call are removed again by
+   * the matching call to @c pop(). Scopes can be nested.
+   */
+  void push();
+
+  /**
+   * Remove formulas added since the matching call to @c push() and close
+   * the innermost scope
+   *
+   * Formulas added before the scope was opened are kept (together with
+   * everything derived from them by the caller), so a problem can be
+   * extended and retracted incrementally without being rebuilt.
+   *
+   * @warning If a formula of the scope was already removed through
+   * @c AnnotatedFormulaIterator::del(), an older occurrence of the same
+   * formula may be removed in its place.
+   */
+  void pop();
+
+  /**
+   * Return the number of scopes opened by @c push() and not yet closed
+   */
+  unsigned scopeDepth();
+
   /**
    * Add formulas parsed from a stream
    *
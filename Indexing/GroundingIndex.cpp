@@ -40,6 +40,7 @@ namespace Indexing
 {
 
 GroundingIndex::GroundingIndex(const Options& opt)
+: _solverClauseCnt(0)
 {
   CALL("GroundingIndex::GroundingIndex");
 
@@ -61,6 +62,17 @@ GroundingIndex::GroundingIndex(const Options& opt)
   _grounder = new GlobalSubsumptionGrounder(_solver.ptr());
 }
 
+/**
+ * Add @b cl to the SAT solver of the index
+ */
+void GroundingIndex::addClause(SATClause* cl)
+{
+  CALL("GroundingIndex::addClause");
+
+  _solver->addClause(cl);
+  _solverClauseCnt++;
+}
+
 void GroundingIndex::handleClause(Clause* c, bool adding)
 {
   CALL("GroundingIndex::handleClause");
@@ -47,12 +47,21 @@ public:
   SATSolverWithAssumptions& getSolver() { return *_solver; }
   GlobalSubsumptionGrounder& getGrounder() { return *_grounder; }
 
+  void addClause(SATClause* cl);
+  /**
+   * Number of clauses added through addClause() so far. The index may be
+   * shared by several users, each of which can tell by this number whether
+   * the solver has changed since it last looked at it.
+   */
+  unsigned solverClauseCount() const { return _solverClauseCnt; }
+
 protected:
   virtual void handleClause(Clause* c, bool adding);
 
 private:
   ScopedPtr<SATSolverWithAssumptions> _solver;
   ScopedPtr<GlobalSubsumptionGrounder> _grounder;
+  unsigned _solverClauseCnt;
 };
 
 }// namespace Indexing
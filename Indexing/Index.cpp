@@ -34,10 +34,8 @@ using namespace Saturation;
 
 Index::~Index()
 {
-  if(!_addedSD.isEmpty()) {
-    ASS(!_removedSD.isEmpty());
-    _addedSD->unsubscribe();
-    _removedSD->unsubscribe();
+  if(_container) {
+    _container->detachIndex(this);
   }
 }
 
@@ -48,10 +46,10 @@ Index::~Index()
  */
 void Index::attachContainer(ClauseContainer* cc)
 {
-  ASS(_addedSD.isEmpty()); //only one container can be attached
+  ASS(!_container); //only one container can be attached
 
-  _addedSD = cc->addedEvent.subscribe(this,&Index::onAddedToContainer);
-  _removedSD = cc->removedEvent.subscribe(this,&Index::onRemovedFromContainer);
+  _container = cc;
+  cc->attachIndex(this);
 }
 
 }// namespace Indexing
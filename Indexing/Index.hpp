@@ -134,20 +134,17 @@ public:
 
   void attachContainer(ClauseContainer* cc);
 protected:
-  Index() {}
-
-  void onAddedToContainer(Clause* c)
-  { handleClause(c, true); }
-  void onRemovedFromContainer(Clause* c)
-  { handleClause(c, false); }
+  Index() : _container(0) {}
 
   virtual void handleClause(Clause* c, bool adding) {}
 
   //TODO: postponing index modifications during iteration (methods isBeingIterated() etc...)
 
 private:
-  SubscriptionData _addedSD;
-  SubscriptionData _removedSD;
+  /** the container notifying the index, zero if none or if it was destroyed */
+  ClauseContainer* _container;
+
+  friend class Saturation::ClauseContainer;
 };
 
 
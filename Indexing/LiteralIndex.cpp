@@ -80,6 +80,7 @@ void LiteralIndex::handleLiteral(Literal* lit, Clause* cl, bool add)
 {
   CALL("LiteralIndex::handleLiteral");
 
+  _modificationCount++;
   if(add) {
     _is->insert(lit, cl);
   } else {
@@ -56,13 +56,20 @@ public:
 
   size_t getUnificationCount(Literal* lit, bool complementary);
 
+  /**
+   * Return the number of insertions and removals done so far, so that
+   * users can tell whether results they cached are still valid
+   */
+  unsigned modificationCount() const { return _modificationCount; }
 
 protected:
-  explicit LiteralIndex(LiteralIndexingStructure* is) : _is(is) {}
+  explicit LiteralIndex(LiteralIndexingStructure* is) : _is(is), _modificationCount(0) {}
 
   void handleLiteral(Literal* lit, Clause* cl, bool add);
 
   LiteralIndexingStructure* _is;
+private:
+  unsigned _modificationCount;
 };
 
 class GeneratingLiteralIndex
@@ -38,7 +38,7 @@ int LiteralMiniIndex::badPred=0;*/
 
 bool LiteralMiniIndex::literalHeaderComparator(const Entry& e1, const Entry& e2)
 {
-  return e1._header<e2._header || ( e1._header==e2._header && e1._weight<e2._weight );
+  return e1._key<e2._key;
 }
 
 LiteralMiniIndex::LiteralMiniIndex(Clause* cl)
@@ -53,6 +53,22 @@ LiteralMiniIndex::LiteralMiniIndex(Literal* const * lits, unsigned length)
   init(lits);
 }
 
+/**
+ * Make the index contain literals of @b cl, reusing the memory
+ * allocated for the previous content.
+ */
+void LiteralMiniIndex::reset(Clause* cl)
+{
+  reset(cl->literals(), cl->length());
+}
+
+void LiteralMiniIndex::reset(Literal* const * lits, unsigned length)
+{
+  _cnt=length;
+  _entries.ensure(length+1);
+  init(lits);
+}
+
 void LiteralMiniIndex::init(Literal* const * lits)
 {
   ASS_G(_cnt, 0);
@@ -42,19 +42,32 @@ public:
   CLASS_NAME(LiteralMiniIndex);
   USE_ALLOCATOR(LiteralMiniIndex);
   
+  LiteralMiniIndex() : _cnt(0) {}
   LiteralMiniIndex(Clause* cl);
   LiteralMiniIndex(Literal* const * lits, unsigned length);
 
+  void reset(Clause* cl);
+  void reset(Literal* const * lits, unsigned length);
+
 private:
   void init(Literal* const * lits);
 
+  /**
+   * The header and the weight of a literal are packed into a single
+   * sort key, so that both are compared by one integer comparison.
+   */
+  typedef unsigned long long SortKey;
+
+  static SortKey makeKey(unsigned header, unsigned weight)
+  { return (static_cast<SortKey>(header)<<32) | weight; }
+
   struct Entry
   {
     Entry() {}
-    void initTerminal() { _header=0xFFFFFFFF; _lit=0; }
-    void init(Literal* lit) { _header=lit->header(); _weight=lit->weight(); _lit=lit; }
-    unsigned _header;
-    unsigned _weight;
+    void initTerminal() { _key=makeKey(0xFFFFFFFF,0); _lit=0; }
+    void init(Literal* lit) { _key=makeKey(lit->header(),lit->weight()); _lit=lit; }
+    unsigned header() const { return static_cast<unsigned>(_key>>32); }
+    SortKey _key;
     Literal* _lit;
   };
 
@@ -71,9 +84,10 @@ private:
     {
       CALL("LiteralMiniIndex::BaseIterator::BaseIterator");
 
+      ASS_G(index._cnt,0);
       Entry* arr=index._entries.array();
-      unsigned weight=query->weight();
-      if(arr[0]._header>=_hdr || index._cnt==1) {
+      SortKey key=makeKey(_hdr, query->weight());
+      if(arr[0].header()>=_hdr || index._cnt==1) {
 	_curr=arr;
 	return;
       }
@@ -81,7 +95,7 @@ private:
       unsigned right=index._cnt-1;
       while(left<right) {
 	unsigned mid=(left+right)/2;
-	if(arr[mid]._header<_hdr || (arr[mid]._header==_hdr && arr[mid]._weight<weight)) {
+	if(arr[mid]._key<key) {
 	  left=mid+1;
 	} else {
 	  right=mid;
@@ -89,9 +103,9 @@ private:
       }
       ASS_EQ(left,right);
       _curr=&arr[right];
-      ASS(_curr->_header==_hdr ||
-	      (_curr->_header<_hdr && (_curr+1)->_header>_hdr) ||
-	      (_curr->_header>_hdr && (_curr==arr || (_curr-1)->_header<_hdr || (_curr-1)->_weight<weight)) );
+      ASS(_curr->header()==_hdr ||
+	      (_curr->header()<_hdr && (_curr+1)->header()>_hdr) ||
+	      (_curr->header()>_hdr && (_curr==arr || (_curr-1)->_key<key)) );
     }
     Literal* next()
     {
@@ -124,7 +138,7 @@ public:
       CALL("LiteralMiniIndex::InstanceIterator::hasNext");
 
       if(_ready) { return true; }
-      while(_curr->_header==_hdr) {
+      while(_curr->header()==_hdr) {
 	bool prediction=_curr->_lit->couldArgsBeInstanceOf(_query);
 #if VDEBUG
 	if(MatchingUtils::match(_query, _curr->_lit, _compl)) {
@@ -158,7 +172,7 @@ public:
       CALL("LiteralMiniIndex::VariantIterator::hasNext");
 
       if(_ready) { return true; }
-      while(_curr->_header==_hdr) {
+      while(_curr->header()==_hdr) {
 	if(MatchingUtils::isVariant(_query, _curr->_lit)) {
 	  _ready=true;
 	  return true;
@@ -68,7 +68,8 @@ Clause* Condensation::simplify(Clause* cl)
   static DArray<LiteralList*> alts(32);
   //static OCMatchIterator matcher;
 
-  LiteralMiniIndex cmi(cl);
+  static LiteralMiniIndex cmi;
+  cmi.reset(cl);
 
   // For each pair of non-equal literals l1 and l2
   //
@@ -82,6 +83,10 @@ Clause* Condensation::simplify(Clause* cl)
     }
     Literal* l1=(*cl)[l1Index];
     Literal* l2=(*cl)[l2Index];
+    if(l1->header()!=l2->header()) {
+      // literals with different predicate or polarity cannot unify
+      continue;
+    }
 
     newLits.ensure(newLen);
 
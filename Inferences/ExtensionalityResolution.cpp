@@ -133,46 +133,6 @@ private:
 
 /////////////////   Backward Extensionality   //////////////////////
 
-/**
- * Functor for filtering negative equality literals of particular sort.
- */
-struct ExtensionalityResolution::NegEqSortFn
-{
-  explicit NegEqSortFn (unsigned sort) : _sort(sort) {}
-  DECL_RETURN_TYPE(bool);
-  OWN_RETURN_TYPE operator()(Literal* lit)
-  {
-    CALL("ExtensionalityResolution::NegEqSortFn::operator()");
-    
-    return lit->isEquality() && lit->isNegative() &&
-      SortHelper::getEqualityArgumentSort(lit) == _sort;
-  }
-private:
-  unsigned _sort;
-};
-
-/**
- * Functor for filtering selected negative literals of particular sort (the sort
- * of the given extensionality clause) in active clauses.
- */
-struct ExtensionalityResolution::BackwardPairingFn
-{
-  explicit BackwardPairingFn (unsigned sort) : _sort(sort) {}
-  DECL_RETURN_TYPE(VirtualIterator<pair<Clause*, Literal*> >);
-  OWN_RETURN_TYPE operator()(Clause* cl)
-  {
-    CALL("ExtensionalityResolution::BackwardPairingFn::operator()");
-    
-    return pvi(pushPairIntoRightIterator(
-        cl,
-        getFilteredIterator(
-          cl->getSelectedLiteralIterator(),
-          NegEqSortFn(_sort))));
-  }
-private:
-  unsigned _sort;
-};
-
 /**
  * This functor computes the unifications between the positive equality of the
  * given extensionality clause and a matching negative equality in some active
@@ -295,19 +255,10 @@ ClauseIterator ExtensionalityResolution::generateClauses(Clause* premise)
   
   if (extLit) {
     // Get all <clause,literal> pairs, where clause is an active clause
-    // and literal a negative equality in clause of same sort as the given
-    // extensionality clause.
-    auto it1 =
-        getMapAndFlattenIterator(
-          // (possible) TODO: We do not actually maintain a set neg_equal of
-          // active clauses having a negative selected equality literal as
-          // described in the extensionality resolution paper. Instead we
-          // iterate the active clauses every time a backward extensionality
-          // resolution inference has to be performed under the assumption
-          // that this happens rarely. Experiments could clarify, which
-          // solution is more efficient.
-          _salg->activeClauses(),
-          BackwardPairingFn(extLit->twoVarEqSort()));
+    // and literal a selected negative equality in clause of same sort as
+    // the given extensionality clause. The container maintains these pairs
+    // by sort (the set neg_equal of the extensionality resolution paper).
+    auto it1 = extClauses->activeNegEqualities(extLit->twoVarEqSort());
 
     // For each <clause,literal> pair, we get 2 substitutions (by unifying
     // X=Y from given extensionality clause and literal.
@@ -58,8 +58,6 @@ private:
   struct ForwardUnificationsFn;
   struct ForwardResultFn;
 
-  struct NegEqSortFn;
-  struct BackwardPairingFn;
   struct BackwardUnificationsFn;
   struct BackwardResultFn;
 };
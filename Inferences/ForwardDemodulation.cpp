@@ -24,10 +24,10 @@
 
 #include "Debug/RuntimeStatistics.hpp"
 
-#include "Lib/DHSet.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Int.hpp"
 #include "Lib/Metaiterators.hpp"
+#include "Lib/SwissMap.hpp"
 #include "Lib/TimeCounter.hpp"
 #include "Lib/Timer.hpp"
 #include "Lib/VirtualIterator.hpp"
@@ -91,7 +91,7 @@ bool ForwardDemodulation::perform(Clause* cl, Clause*& replacement, ClauseIterat
   //replace subterms in some special order, like
   //the heaviest first...
 
-  static DHSet<TermList> attempted;
+  static SwissSet<TermList> attempted;
   attempted.reset();
 
   unsigned cLen=cl->length();
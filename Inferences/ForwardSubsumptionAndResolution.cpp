@@ -288,7 +288,8 @@ bool ForwardSubsumptionAndResolution::perform(Clause* cl, Clause*& replacement,
   }
 
   {
-  LiteralMiniIndex miniIndex(cl);
+  static LiteralMiniIndex miniIndex;
+  miniIndex.reset(cl);
 
   for(unsigned li=0;li<clen;li++) {
     SLQueryResultIterator rit=_fwIndex->getGeneralizations( (*cl)[li], false, false);
@@ -21,6 +21,8 @@
  * Implements class GlobalSubsumption.
  */
 
+#include <algorithm>
+
 #include "Debug/RuntimeStatistics.hpp"
 
 #include "Lib/Metaiterators.hpp"
@@ -161,20 +163,48 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   }
   
   SATSolverWithAssumptions& solver = _index->getSolver();
-  
+
   // Would be nice to have this:
   // ASS_NEQ(solver.solve(_uprOnly),SATSolver::UNSATISFIABLE);
   // But even if the last addition made the SAT solver's content unconditionally inconsistent
   // the last call to solveUnderAssumptions might have missed that
 
-  // create SAT clause and add to solver
-  SATClause* scl = SATClause::fromStack(plits);
-  SATInference* inf = new FOConversionInference(cl);
-  scl->setInference(inf);
-  solver.addClause(scl);
+  // look the abstraction up among those we have already seen
+  static AbstractionKey key;
+  key.reset();
+  for (unsigned i = 0; i < plits.size(); i++) {
+    key.push(2*plits[i].var()+(plits[i].isNegative() ? 0 : 1));
+  }
+  std::sort(key.begin(), key.end());
+
+  unsigned* lastFailure;
+  bool newAbstraction = _checkedAbstractions.getValuePtr(key, lastFailure, NO_FAILURE);
+
+  if (!newAbstraction && !_splitter && *lastFailure == _index->solverClauseCount()) {
+    // nothing was added to the solver since the same abstraction failed to reduce
+    // (with gsaa=full_model the assumptions depend on the current model, so we cannot tell)
+    RSTAT_CTR_INC("global_subsumption_cached_failures");
+    return cl;
+  }
+
+  if (newAbstraction) {
+    // create SAT clause and add to solver
+    SATClause* scl = SATClause::fromStack(plits);
+    SATInference* inf = new FOConversionInference(cl);
+    scl->setInference(inf);
+    _index->addClause(scl);
+  }
 
   // check for subsuming clause by looking for a proper subset of used assumptions
-  SATSolver::Status res = solver.solveUnderAssumptions(assumps, _uprOnly, true /* only proper subsets */);
+  SATSolver::Status res = SATSolver::UNKNOWN;
+  if (!_uprOnly) {
+    // try unit propagation first, the full solve is only needed when it does not suffice
+    res = solver.solveUnderAssumptions(assumps, true /* only propagation */, true /* only proper subsets */);
+  }
+  if (res != SATSolver::UNSATISFIABLE || solver.failedAssumptions().size() >= assumps.size()) {
+    // propagation did not find a proper subset, the full solve still may
+    res = solver.solveUnderAssumptions(assumps, _uprOnly, true /* only proper subsets */);
+  }
 
   if (res == SATSolver::UNSATISFIABLE) { 
     // it should always be UNSAT with full assumps,
@@ -266,6 +296,7 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
     }
   }
 
+  *lastFailure = _index->solverClauseCount();
   return cl;
 }
 
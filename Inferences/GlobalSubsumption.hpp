@@ -25,6 +25,8 @@
 #define __GlobalSubsumption__
 
 #include "Forwards.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
 #include "Indexing/GroundingIndex.hpp"
 #include "Shell/Options.hpp"
 
@@ -106,6 +108,23 @@ private:
    * An inverse of the above map, for convenience.
    */  
   DHMap<unsigned, unsigned> _vars2splits;
+
+  /**
+   * Propositional abstraction of a clause as a sorted stack of encoded SAT literals.
+   */
+  typedef Stack<unsigned> AbstractionKey;
+
+  static const unsigned NO_FAILURE = 0xFFFFFFFF;
+
+  /**
+   * Abstractions already added to the SAT solver, mapped to the number of
+   * clauses in the solver of _index when their last check did not lead to
+   * a reduction (or NO_FAILURE if it did).
+   *
+   * A repeated abstraction does not need to be added to the solver again
+   * and, unless the solver has grown since, it cannot be reduced either.
+   */
+  DHMap<AbstractionKey, unsigned> _checkedAbstractions;
       
 protected:  
   unsigned splitLevelToVar(SplitLevel lev) {        
@@ -73,6 +73,11 @@ void HyperSuperposition::attach(SaturationAlgorithm* salg)
   ForwardSimplificationEngine::attach(salg);
   _index=static_cast<UnitClauseLiteralIndex*> (
 	  _salg->getIndexManager()->request(SIMPLIFYING_UNIT_CLAUSE_SUBST_TREE) );
+
+  _rewriterLimit = getOptions().hyperSuperpositionRewriterLimit();
+  _candidateLimit = getOptions().hyperSuperpositionCandidateLimit();
+  _rewriterCache.reset();
+  _cacheValidity = _index->modificationCount();
 }
 
 void HyperSuperposition::detach()
@@ -81,6 +86,7 @@ void HyperSuperposition::detach()
   ASS(_salg);
 
   _index=0;
+  _rewriterCache.reset();
   _salg->getIndexManager()->release(SIMPLIFYING_UNIT_CLAUSE_SUBST_TREE);
 //  GeneratingInferenceEngine::detach();
   ForwardSimplificationEngine::detach();
@@ -134,6 +140,10 @@ bool HyperSuperposition::tryMakeTopUnifiableByRewriter(TermList t1, TermList t2,
   if(subst.unify(t1, 0, t2, t2Bank)) {
     return true;
   }
+  if(_rewriterLimit && rewriters.size()>=_rewriterLimit) {
+    RSTAT_CTR_INC("hyper-superposition rewriter limit reached");
+    return false;
+  }
 
   TermList ut1 = subst.apply(t1, 0);
   TermList ut2 = subst.apply(t2, t2Bank);
@@ -150,20 +160,17 @@ bool HyperSuperposition::tryMakeTopUnifiableByRewriter(TermList t1, TermList t2,
   }
   Literal* queryEq = Literal::createEquality(true, ut1, ut2, srt);
 
-  SLQueryResultIterator srqi = _index->getUnifications(queryEq, false, false);
-  if(!srqi.hasNext()) {
+  Literal* rwrLit;
+  Clause* rwrCl;
+  if(!findRewriter(queryEq, rwrLit, rwrCl)) {
     return false;
   }
-  //for now we just get the first result
-  SLQueryResult qr = srqi.next();
-  Color clr = ColorHelper::combine(infClr, qr.clause->color());
+  Color clr = ColorHelper::combine(infClr, rwrCl->color());
   if(clr==COLOR_INVALID) {
     return false;
   }
   infClr = clr;
 
-  Literal* rwrLit = qr.literal;
-
   TermList rwrT1 = *rwrLit->nthArgument(0);
   TermList rwrT2 = *rwrLit->nthArgument(1);
 
@@ -174,10 +181,46 @@ bool HyperSuperposition::tryMakeTopUnifiableByRewriter(TermList t1, TermList t2,
   }
 
   rewriters.push(make_pair(TermPair(rwrT1,rwrT2), rwrBankIdx));
-  premises.push(qr.clause);
+  premises.push(rwrCl);
   return true;
 }
 
+/**
+ * Find a unit equality unifying with @c queryEq and return true, or return false
+ * if there is none. For now we just take the first one the index returns.
+ *
+ * The same query equalities are asked for repeatedly, so the answers are cached
+ * until the index changes.
+ */
+bool HyperSuperposition::findRewriter(Literal* queryEq, Literal*& rwrLit, Clause*& rwrCl)
+{
+  CALL("HyperSuperposition::findRewriter");
+
+  if(_cacheValidity!=_index->modificationCount()) {
+    _rewriterCache.reset();
+    _cacheValidity = _index->modificationCount();
+  }
+
+  RewriterRecord* rec;
+  if(_rewriterCache.getValuePtr(queryEq, rec)) {
+    SLQueryResultIterator srqi = _index->getUnifications(queryEq, false, false);
+    if(srqi.hasNext()) {
+      SLQueryResult qr = srqi.next();
+      *rec = RewriterRecord(qr.literal, qr.clause);
+    }
+    else {
+      *rec = RewriterRecord(0, 0);
+    }
+  }
+  else {
+    RSTAT_CTR_INC("hyper-superposition cached rewriter lookups");
+  }
+
+  rwrLit = rec->first;
+  rwrCl = rec->second;
+  return rwrCl;
+}
+
 /**
  * the content of the reference arguments is undefined in case of failure
  */
@@ -396,7 +439,8 @@ void HyperSuperposition::tryUnifyingToResolveWithUnit(Clause* cl, unsigned liter
 
   static ClauseStack localRes;
 
-  while(unifIt.hasNext()) {
+  unsigned tried = 0;
+  while(unifIt.hasNext() && (!_candidateLimit || tried++<_candidateLimit)) {
     SLQueryResult unifRes = unifIt.next();
     localRes.reset();
     tryUnifyingSuperpositioins(cl, literalIndex, lit, unifRes.literal, true, localRes);
@@ -544,7 +588,8 @@ bool HyperSuperposition::tryUnifyingToResolveSimpl(Clause* cl, Clause*& replacem
 
   static ClauseStack prems;
 
-  while(unifIt.hasNext()) {
+  unsigned tried = 0;
+  while(unifIt.hasNext() && (!_candidateLimit || tried++<_candidateLimit)) {
     SLQueryResult unifRes = unifIt.next();
     prems.reset();
     prems.push(unifRes.clause);
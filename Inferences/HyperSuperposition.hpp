@@ -29,6 +29,8 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
+
 #include "InferenceEngine.hpp"
 
 namespace Inferences
@@ -45,7 +47,7 @@ public:
   CLASS_NAME(HyperSuperposition);
   USE_ALLOCATOR(HyperSuperposition);
 
-  HyperSuperposition() : _index(0) {}
+  HyperSuperposition() : _index(0), _rewriterLimit(0), _candidateLimit(0), _cacheValidity(0) {}
 
   void attach(SaturationAlgorithm* salg) override;
   void detach() override;
@@ -101,7 +103,23 @@ private:
 
   static bool rewriterEntryComparator(RewriterEntry p1, RewriterEntry p2);
 
+  bool findRewriter(Literal* queryEq, Literal*& rwrLit, Clause*& rwrCl);
+
   UnitClauseLiteralIndex* _index;
+
+  /** Maximal number of rewriters used to unify two terms, zero means no limit */
+  unsigned _rewriterLimit;
+  /** Maximal number of unit clauses tried as resolution partners, zero means no limit */
+  unsigned _candidateLimit;
+
+  /**
+   * The first rewriter the index returned for each query equality
+   * (with zero clause if there was none). Valid as long as the index
+   * has the modification count @c _cacheValidity.
+   */
+  typedef pair<Literal*,Clause*> RewriterRecord;
+  DHMap<Literal*,RewriterRecord> _rewriterCache;
+  unsigned _cacheValidity;
 };
 
 };// namespace Inferences
@@ -68,14 +68,23 @@ TermList TermReplacement::transformSubterm(TermList trm)
   return trm;
 }
 
+void Induction::attach(SaturationAlgorithm* salg)
+{
+  CALL("Induction::attach");
+
+  GeneratingInferenceEngine::attach(salg);
+  _index.reset();
+}
+
 ClauseIterator Induction::generateClauses(Clause* premise)
 {
   CALL("Induction::generateClauses");
 
-  return pvi(InductionClauseIterator(premise));
+  return pvi(InductionClauseIterator(premise, _index));
 }
 
-InductionClauseIterator::InductionClauseIterator(Clause* premise)
+InductionClauseIterator::InductionClauseIterator(Clause* premise, InductionSchemaIndex& index)
+: _index(index)
 {
   CALL("InductionClauseIterator::InductionClauseIterator");
 
@@ -117,11 +126,14 @@ void InductionClauseIterator::process(Clause* premise, Literal* lit)
   if((!negOnly || lit->isNegative() || 
          (theory->isInterpretedPredicate(lit) && theory->isInequality(theory->interpretPredicate(lit)))
        )&& 
-       lit->ground()
+       lit->ground() && lit->arity()!=0 &&
+       !_index.knownWithoutCandidates(lit)
       ){
 
-      Set<Term*> ta_terms;
-      Set<Term*> int_terms;
+      static Set<Term*> ta_terms;
+      static Set<Term*> int_terms;
+      ta_terms.reset();
+      int_terms.reset();
       SubtermIterator it(lit);
       it.next(); // to move past the lit symbol
       while(it.hasNext()){
@@ -149,6 +161,11 @@ void InductionClauseIterator::process(Clause* premise, Literal* lit)
           }
         }
       }
+      if(ta_terms.size()==0 && int_terms.size()==0){
+        // the candidates only depend on the (shared) literal
+        _index.recordWithoutCandidates(lit);
+        return;
+      }
       Set<Term*>::Iterator citer1(int_terms);
       while(citer1.hasNext()){
         Term* t = citer1.next();
@@ -156,7 +173,7 @@ void InductionClauseIterator::process(Clause* premise, Literal* lit)
                           env.options->mathInduction() == Options::MathInductionKind::ALL;
         static bool two = env.options->mathInduction() == Options::MathInductionKind::TWO ||
                           env.options->mathInduction() == Options::MathInductionKind::ALL;
-        if(notDone(lit,t)){
+        if(_index.notDone(lit,t)){
           if(one){
             performMathInductionOne(premise,lit,t);
           }
@@ -176,7 +193,7 @@ void InductionClauseIterator::process(Clause* premise, Literal* lit)
         static bool three = env.options->structInduction() == Options::StructuralInductionKind::THREE ||
                           env.options->structInduction() == Options::StructuralInductionKind::ALL;
 
-        if(notDone(lit,t)){
+        if(_index.notDone(lit,t)){
 
           if(one){
             performStructInductionOne(premise,lit,t);
@@ -647,31 +664,46 @@ void InductionClauseIterator::performStructInductionThree(Clause* premise, Liter
   env.statistics->induction++; 
 }
 
-bool InductionClauseIterator::notDone(Literal* lit, Term* term)
+void InductionSchemaIndex::reset()
 {
-  CALL("InductionClauseIterator::notDone");
+  CALL("InductionSchemaIndex::reset");
 
-  static DHSet<Literal*> done;
-  static DHMap<unsigned,TermList> blanks; 
-  unsigned srt = env.signature->getFunction(term->functor())->fnType()->result();
+  _seen.reset();
+  _contexts.reset();
+  _noCandidates.reset();
+}
+
+TermList InductionSchemaIndex::getBlank(unsigned srt)
+{
+  CALL("InductionSchemaIndex::getBlank");
 
-  if(!blanks.find(srt)){
+  TermList* blank;
+  if(_blanks.getValuePtr(srt,blank)){
     unsigned fresh = env.signature->addFreshFunction(0,"blank");
     env.signature->getFunction(fresh)->setType(OperatorType::getConstantsType(srt));
-    TermList blank = TermList(Term::createConstant(fresh));
-    blanks.insert(srt,blank);
+    *blank = TermList(Term::createConstant(fresh));
   }
+  return *blank;
+}
 
-  TermReplacement cr(term,blanks.get(srt));
-  Literal* rep = cr.transform(lit);
+/**
+ * Return true if induction on @b term in @b lit has not been done yet,
+ * and record that it is being done now.
+ */
+bool InductionSchemaIndex::notDone(Literal* lit, Term* term)
+{
+  CALL("InductionSchemaIndex::notDone");
 
-  if(done.contains(rep)){ 
-    return false; 
+  if(!_seen.insert(Application(lit,term))){
+    // the very same literal and term were looked at before
+    return false;
   }
 
-  done.insert(rep);
+  unsigned srt = env.signature->getFunction(term->functor())->fnType()->result();
+  TermReplacement cr(term,getBlank(srt));
+  Literal* rep = cr.transform(lit);
 
-  return true;
+  return _contexts.insert(rep);
 }
 
 }// namespace Inferences
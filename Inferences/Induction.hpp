@@ -26,6 +26,9 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
+
 #include "Kernel/TermTransformer.hpp"
 
 #include "InferenceEngine.hpp"
@@ -46,6 +49,40 @@ private:
   TermList _r;
 };
 
+/**
+ * Records of the induction applications performed so far, shared by
+ * all premises of one saturation run.
+ *
+ * An application on term @b t in literal @b L[t] is identified by
+ * its context, the literal L[blank] where t is replaced by a fresh
+ * constant of the sort of t. The (literal, term) pairs already looked
+ * at are remembered as well, so that the context is only built once.
+ */
+class InductionSchemaIndex
+{
+public:
+  CLASS_NAME(InductionSchemaIndex);
+  USE_ALLOCATOR(InductionSchemaIndex);
+
+  bool notDone(Literal* lit, Term* t);
+
+  bool knownWithoutCandidates(Literal* lit) const { return _noCandidates.contains(lit); }
+  void recordWithoutCandidates(Literal* lit) { _noCandidates.insert(lit); }
+
+  void reset();
+
+private:
+  TermList getBlank(unsigned srt);
+
+  typedef pair<Literal*,Term*> Application;
+
+  DHSet<Application> _seen;
+  DHSet<Literal*> _contexts;
+  DHSet<Literal*> _noCandidates;
+  /** Blank constants by sort, these survive @c reset() as they live in the signature */
+  DHMap<unsigned,TermList> _blanks;
+};
+
 class Induction
 : public GeneratingInferenceEngine
 {
@@ -54,15 +91,18 @@ public:
   USE_ALLOCATOR(Induction);
 
   Induction() {}
+  void attach(SaturationAlgorithm* salg) override;
   ClauseIterator generateClauses(Clause* premise);
 
+private:
+  InductionSchemaIndex _index;
 };
 
 class InductionClauseIterator
 {
 public:
   // all the work happens in the constructor!
-  explicit InductionClauseIterator(Clause* premise);
+  InductionClauseIterator(Clause* premise, InductionSchemaIndex& index);
 
   CLASS_NAME(InductionClauseIterator);
   USE_ALLOCATOR(InductionClauseIterator);
@@ -85,9 +125,8 @@ private:
   void performStructInductionTwo(Clause* premise, Literal* lit, Term* t);
   void performStructInductionThree(Clause* premise, Literal* lit, Term* t);
 
-  bool notDone(Literal* lit, Term* t);
-
   Stack<Clause*> _clauses;
+  InductionSchemaIndex& _index;
 };
 
 };// namespace Inferences
@@ -29,7 +29,8 @@
 #include "Lib/Metaiterators.hpp"
 #include "Lib/VirtualIterator.hpp"
 #include "Lib/DArray.hpp"
-#include "Lib/Set.hpp"
+#include "Lib/Comparison.hpp"
+#include "Lib/Sort.hpp"
 
 #include "Kernel/Clause.hpp"
 #include "Kernel/Inference.hpp"
@@ -40,6 +41,7 @@
 #include "Kernel/Theory.hpp"
 #include "Kernel/TermIterators.hpp"
 
+#include "Shell/Options.hpp"
 #include "Shell/Statistics.hpp"
 
 #include "Instantiation.hpp"
@@ -106,16 +108,65 @@ void Instantiation::init(){
   }
 */
 
+CandidateTermStore::~CandidateTermStore()
+{
+  CALL("CandidateTermStore::~CandidateTermStore");
+
+  DHMap<unsigned,SortCandidates*>::Iterator it(_sorts);
+  while(it.hasNext()){
+    delete it.next();
+  }
+}
+
 /**
- * Let's still store the per-sort constants from the problem
- *
+ * Record an occurrence of the ground term @b t of sort @b sort
  */
-void Instantiation::registerClause(Clause* cl)
+void CandidateTermStore::registerTerm(Term* t, unsigned sort)
 {
-  CALL("Instantiation::registerClause");
-  ASS(cl);
+  CALL("CandidateTermStore::registerTerm");
+  ASS(t->ground());
 
-  //cout << "register " << cl->toString() << endl;
+  _time++;
+
+  SortCandidates** pcans;
+  if(_sorts.getValuePtr(sort,pcans)){
+    *pcans = new SortCandidates();
+  }
+  SortCandidates& cans = **pcans;
+  cans.rankingValid = false;
+
+  unsigned* ppos;
+  if(!cans.positions.getValuePtr(t,ppos)){
+    Entry& e = cans.entries[*ppos];
+    e.frequency++;
+    e.lastSeen = _time;
+    return;
+  }
+  if(!_capacity || cans.entries.size()<_capacity){
+    *ppos = cans.entries.size();
+    cans.entries.push(Entry(t,_time));
+    return;
+  }
+
+  // the sort is full, replace the lowest ranked candidate
+  unsigned worst = 0;
+  for(unsigned i=1;i<cans.entries.size();i++){
+    if(cans.entries[i].worseThan(cans.entries[worst])){
+      worst = i;
+    }
+  }
+  ALWAYS(cans.positions.remove(cans.entries[worst].term));
+  *ppos = worst;
+  cans.entries[worst] = Entry(t,_time);
+  RSTAT_CTR_INC("instantiation candidates replaced");
+}
+
+/**
+ * Register all ground non-variable subterms of @b cl whose sort is not the default one
+ */
+void CandidateTermStore::registerGroundSubterms(Clause* cl)
+{
+  CALL("CandidateTermStore::registerGroundSubterms");
 
   Clause::Iterator cit(*cl);
   while(cit.hasNext()){
@@ -127,26 +178,81 @@ void Instantiation::registerClause(Clause* cl)
         unsigned sort;
         if(SortHelper::tryGetResultSort(t,sort)){
           if(sort==Sorts::SRT_DEFAULT) continue;
-          Set<Term*>* cans_check=0;
-          Stack<Term*>* cans=0;
-          if(sorted_candidates.isEmpty() || !sorted_candidates.find(sort,cans)){
-            cans_check = new Set<Term*>();
-            cans = new Stack<Term*>();
-            sorted_candidates.insert(sort,cans);
-            sorted_candidates_check.insert(sort,cans_check);
-          }
-          else{ ALWAYS(sorted_candidates_check.find(sort,cans_check)); }
-          ASS(cans_check && cans);
-          // cout << "For sort " << sort << " there are " << cans->size() << " cans" <<endl;
-          if(!cans_check->contains(t.term())){
-            cans_check->insert(t.term());
-            cans->push(t.term());
-          }
+          registerTerm(t.term(),sort);
         }
       }
     }
   }
+}
+
+struct CandidateTermStore::EntryComparator
+{
+  static Comparison compare(const Entry& e1, const Entry& e2)
+  {
+    // better entries go first
+    if(e2.worseThan(e1)) { return LESS; }
+    if(e1.worseThan(e2)) { return GREATER; }
+    return EQUAL;
+  }
+};
+
+void CandidateTermStore::getRankedCandidates(unsigned sort, Stack<Term*>& acc)
+{
+  CALL("CandidateTermStore::getRankedCandidates");
+
+  SortCandidates* cans;
+  if(!_sorts.find(sort,cans) || cans->entries.isEmpty()){
+    return;
+  }
+
+  if(!_capacity){
+    // nothing is ever replaced, so keep the order instantiation used before
+    // the store existed: the most recently added term first
+    Stack<Entry>::Iterator eit(cans->entries);
+    while(eit.hasNext()){
+      acc.push(eit.next().term);
+    }
+    return;
+  }
 
+  // terms are registered mostly with the input clauses, so the ranking
+  // is computed again only when the sort changed since the last query
+  if(!cans->rankingValid){
+    static Stack<Entry> ranked;
+    ranked = cans->entries;
+    Lib::sort<EntryComparator>(ranked.begin(),ranked.end());
+
+    cans->ranking.reset();
+    Stack<Entry>::BottomFirstIterator rit(ranked);
+    while(rit.hasNext()){
+      cans->ranking.push(rit.next().term);
+    }
+    cans->rankingValid = true;
+  }
+
+  Stack<Term*>::BottomFirstIterator cit(cans->ranking);
+  while(cit.hasNext()){
+    acc.push(cit.next());
+  }
+}
+
+Instantiation::Instantiation()
+: _candidates(env.options->instantiationCandidateLimit())
+{
+}
+
+/**
+ * Let's still store the per-sort constants from the problem
+ *
+ */
+void Instantiation::registerClause(Clause* cl)
+{
+  CALL("Instantiation::registerClause");
+  ASS(cl);
+
+  //cout << "register " << cl->toString() << endl;
+
+  _candidates.registerGroundSubterms(cl);
 }
 
 /**
@@ -246,12 +352,10 @@ VirtualIterator<Term*> Instantiation::getCandidateTerms(Clause* cl, unsigned var
 {
   CALL("Instantiation::getCandidateTerms");
 
-  Stack<Term*>* cans=0;
-  VirtualIterator<Term*> res = VirtualIterator<Term*>::getEmpty();
-  if(sorted_candidates.find(sort,cans) && cans->size()){
-    res = pvi(Stack<Term*>::Iterator(*cans));
-  }
-  return res; 
+  static Stack<Term*> cans;
+  cans.reset();
+  _candidates.getRankedCandidates(sort,cans);
+  return getPersistentIterator(Stack<Term*>::BottomFirstIterator(cans));
 }
 
 class Instantiation::AllSubstitutionsIterator{
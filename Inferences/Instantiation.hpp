@@ -26,7 +26,8 @@
 #define __Instantiation__
 
 #include "Forwards.hpp"
-#include "Lib/Set.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/Stack.hpp"
 #include "Kernel/Sorts.hpp"
 
 #include "Kernel/Theory.hpp"
@@ -38,6 +39,69 @@ namespace Inferences
 using namespace Kernel;
 
 
+/**
+ * Ground terms to instantiate variables with, kept separately for each sort.
+ *
+ * Each sort holds at most @b capacity distinct terms (zero means no limit).
+ * Terms are ranked by the number of times they were registered and, among
+ * equally frequent ones, by how recently they were seen; when a sort is full,
+ * the lowest ranked term gives way to the new one. Without a limit no
+ * ranking is needed and candidates keep the order they were added in.
+ *
+ * The store does not depend on a particular inference and can be shared by
+ * several of them.
+ */
+class CandidateTermStore
+{
+public:
+  CLASS_NAME(CandidateTermStore);
+  USE_ALLOCATOR(CandidateTermStore);
+
+  explicit CandidateTermStore(unsigned capacity) : _capacity(capacity), _time(0) {}
+  ~CandidateTermStore();
+
+  void registerTerm(Term* t, unsigned sort);
+  void registerGroundSubterms(Clause* cl);
+
+  /**
+   * Push the candidates of @b sort on @b acc. If the capacity is limited,
+   * the best ranked come first, otherwise the most recently added ones.
+   */
+  void getRankedCandidates(unsigned sort, Stack<Term*>& acc);
+
+private:
+  struct Entry {
+    Entry(Term* t, unsigned time) : term(t), frequency(1), lastSeen(time) {}
+
+    bool worseThan(const Entry& o) const
+    { return frequency<o.frequency || (frequency==o.frequency && lastSeen<o.lastSeen); }
+
+    Term* term;
+    unsigned frequency;
+    unsigned lastSeen;
+  };
+  struct SortCandidates {
+    CLASS_NAME(CandidateTermStore::SortCandidates);
+    USE_ALLOCATOR(SortCandidates);
+
+    SortCandidates() : rankingValid(false) {}
+
+    Stack<Entry> entries;
+    /** Position of each stored term in @b entries */
+    DHMap<Term*,unsigned> positions;
+    /** Terms of @b entries, the best ranked first, valid if @b rankingValid */
+    Stack<Term*> ranking;
+    /** False if @b entries changed since @b ranking was computed */
+    bool rankingValid;
+  };
+  struct EntryComparator;
+
+  unsigned _capacity;
+  /** Incremented for every registered term */
+  unsigned _time;
+  DHMap<unsigned,SortCandidates*> _sorts;
+};
+
 class Instantiation
 : public GeneratingInferenceEngine
 {
@@ -45,7 +109,7 @@ public:
   CLASS_NAME(Instantiation);
   USE_ALLOCATOR(Instantiation);
 
-  Instantiation() {}
+  Instantiation();
 
   //void init();
 
@@ -61,8 +125,7 @@ private:
   void tryMakeLiteralFalse(Literal*, Stack<Substitution>& subs);
   Term* tryGetDifferentValue(Term* t); 
 
-  DHMap<unsigned,Lib::Set<Term*>*> sorted_candidates_check;
-  DHMap<unsigned,Lib::Stack<Term*>*> sorted_candidates;
+  CandidateTermStore _candidates;
 
 };
 
@@ -28,6 +28,7 @@
 #include "Lib/Int.hpp"
 #include "Lib/Metaiterators.hpp"
 #include "Lib/PairUtils.hpp"
+#include "Lib/Stack.hpp"
 #include "Lib/VirtualIterator.hpp"
 
 #include "Kernel/Clause.hpp"
@@ -56,7 +57,7 @@ using namespace Indexing;
 using namespace Saturation;
 
 URResolution::URResolution()
-: _selectedOnly(false), _unitIndex(0), _nonUnitIndex(0) {}
+: _selectedOnly(false), _unitIndex(0), _nonUnitIndex(0), _resultLimit(0), _resultCnt(0) {}
 
 /**
  * Creates URResolution object with explicitely supplied
@@ -67,7 +68,8 @@ URResolution::URResolution()
  */
 URResolution::URResolution(bool selectedOnly, UnitClauseLiteralIndex* unitIndex,
     NonUnitClauseLiteralIndex* nonUnitIndex)
-: _emptyClauseOnly(false), _selectedOnly(selectedOnly), _unitIndex(unitIndex), _nonUnitIndex(nonUnitIndex) {}
+: _emptyClauseOnly(false), _selectedOnly(selectedOnly), _unitIndex(unitIndex), _nonUnitIndex(nonUnitIndex),
+  _resultLimit(0), _resultCnt(0) {}
 
 void URResolution::attach(SaturationAlgorithm* salg)
 {
@@ -85,6 +87,7 @@ void URResolution::attach(SaturationAlgorithm* salg)
   Options::URResolution optSetting = _salg->getOptions().unitResultingResolution();
   ASS_NEQ(optSetting,  Options::URResolution::OFF);
   _emptyClauseOnly = optSetting==Options::URResolution::EC_ONLY;
+  _resultLimit = _salg->getOptions().unitResultingResolutionLimit();
 }
 
 void URResolution::detach()
@@ -197,6 +200,31 @@ struct URResolution::Item
     return res;
   }
 
+  /**
+   * Push the current literals on @c trail, so that they can be
+   * brought back by @c restoreLiterals() after a resolution step
+   * is undone.
+   */
+  void saveLiterals(Stack<Literal*>& trail) const
+  {
+    CALL("URResolution::Item::saveLiterals");
+
+    unsigned clen = _lits.size();
+    for(unsigned i=0; i<clen; i++) {
+      trail.push(_lits[i]);
+    }
+  }
+
+  void restoreLiterals(Stack<Literal*>& trail)
+  {
+    CALL("URResolution::Item::restoreLiterals");
+
+    unsigned clen = _lits.size();
+    for(unsigned i=clen; i>0; i--) {
+      _lits[i-1] = trail.pop();
+    }
+  }
+
   int getGoodness(Literal* lit)
   {
     CALL("URResolution::Item::getGoodness");
@@ -263,49 +291,64 @@ struct URResolution::Item
 };
 
 /**
- * Perform one level of the BFS traversal of possible resolution
- * sequences
+ * Explore the ways of resolving away the literal at @c idx and all
+ * the literals after it, adding the clauses of the successful
+ * sequences into @c acc.
  *
- * (See documentation to the @c processAndGetClauses() function.)
+ * The traversal is depth-first on the single item @c itm which is
+ * modified in place; before a literal is resolved, the current
+ * literals are saved on @c _litTrail and they are restored when
+ * the search backtracks. This way no items need to be copied.
  */
-void URResolution::processLiteral(ItemList*& itms, unsigned idx)
+void URResolution::processLiteral(Item& itm, unsigned idx, ClauseList*& acc)
 {
   CALL("URResolution::processLiteral");
 
-  ItemList::DelIterator iit(itms);
-  while(iit.hasNext()) {
-    Item* itm = iit.next();
-    itm->getBestLiteralReady(idx);
-    Literal* lit = itm->_lits[idx];
-    ASS(lit);
-
-    if(!itm->_mustResolveAll) {
-      Item* itm2 = new Item(*itm);
-      itm2->_mustResolveAll = true;
-      iit.insert(itm2);
-    }
+  if(resultLimitReached()) {
+    return;
+  }
+  if(idx==itm._activeLength) {
+    ClauseList::push(itm.generateClause(), acc);
+    env.statistics->urResolution++;
+    _resultCnt++;
+    return;
+  }
 
-    SLQueryResultIterator unifs = _unitIndex->getUnifications(lit, true, true);
-    while(unifs.hasNext()) {
-      SLQueryResult unif = unifs.next();
+  itm.getBestLiteralReady(idx);
+  Literal* lit = itm._lits[idx];
+  ASS(lit);
 
-      if( !ColorHelper::compatible(itm->_color, unif.clause->color()) ) {
-        continue;
-      }
+  if(!itm._mustResolveAll) {
+    itm._mustResolveAll = true;
+    processLiteral(itm, idx+1, acc);
+    itm._mustResolveAll = false;
+  }
 
-      Item* itm2 = new Item(*itm);
-      itm2->resolveLiteral(idx, unif, unif.clause, true);
-      iit.insert(itm2);
+  SLQueryResultIterator unifs = _unitIndex->getUnifications(lit, true, true);
+  while(unifs.hasNext() && !resultLimitReached()) {
+    SLQueryResult unif = unifs.next();
 
-      if(itm->_atMostOneNonGround) {
-	//if there is only one non-ground literal left, there is no need to retrieve
-	//all unifications
-	break;
-      }
+    if( !ColorHelper::compatible(itm._color, unif.clause->color()) ) {
+      continue;
     }
 
-    iit.del();
-    delete itm;
+    bool atMostOneNonGround = itm._atMostOneNonGround;
+    Color color = itm._color;
+    itm.saveLiterals(_litTrail);
+
+    itm.resolveLiteral(idx, unif, unif.clause, true);
+    processLiteral(itm, idx+1, acc);
+
+    itm.restoreLiterals(_litTrail);
+    itm._premises[idx] = 0;
+    itm._color = color;
+    itm._atMostOneNonGround = atMostOneNonGround;
+
+    if(atMostOneNonGround) {
+      //if there is only one non-ground literal left, there is no need to retrieve
+      //all unifications
+      break;
+    }
   }
 }
 
@@ -314,30 +357,18 @@ void URResolution::processLiteral(ItemList*& itms, unsigned idx)
  * and from the successful ones add the resulting clause into
  * @c acc. The search starts at literal with index @c startIdx.
  *
- * What we do is a BFS traversal of all possible resolutions
- * on the clause represented in @c itm. In the @c itms list we
- * store all elements of @c i -th level of the search, and a
- * call to the @c processLiteral() function moves us to the next
- * level of the traversal.
+ * The exploration stops early once the number of clauses generated
+ * by the current call to @c generateClauses() reaches the limit
+ * given by the unit_resulting_resolution_limit option.
  */
-void URResolution::processAndGetClauses(Item* itm, unsigned startIdx, ClauseList*& acc)
+void URResolution::processAndGetClauses(Item& itm, unsigned startIdx, ClauseList*& acc)
 {
   CALL("URResolution::processAndGetClauses");
+  ASS(_litTrail.isEmpty());
 
-  unsigned activeLen = itm->_activeLength;
+  processLiteral(itm, startIdx, acc);
 
-  ItemList* itms = 0;
-  ItemList::push(itm, itms);
-  for(unsigned i = startIdx; itms && i<activeLen; i++) {
-    processLiteral(itms, i);
-  }
-
-  while(itms) {
-    Item* itm = ItemList::pop(itms);
-    ClauseList::push(itm->generateClause(), acc);
-    env.statistics->urResolution++;
-    delete itm;
-  }
+  ASS(_litTrail.isEmpty());
 }
 
 /**
@@ -359,13 +390,17 @@ void URResolution::doBackwardInferences(Clause* cl, ClauseList*& acc)
       continue;
     }
 
-    Item* itm = new Item(ucl, _selectedOnly, *this, _emptyClauseOnly);
+    Item itm(ucl, _selectedOnly, *this, _emptyClauseOnly);
     unsigned pos = ucl->getLiteralPosition(unif.literal);
     ASS(!_selectedOnly || pos<ucl->numSelected());
-    swap(itm->_lits[0], itm->_lits[pos]);
-    itm->resolveLiteral(0, unif, cl, false);
+    swap(itm._lits[0], itm._lits[pos]);
+    itm.resolveLiteral(0, unif, cl, false);
 
     processAndGetClauses(itm, 1, acc);
+
+    if(resultLimitReached()) {
+      break;
+    }
   }
 }
 
@@ -380,10 +415,15 @@ ClauseIterator URResolution::generateClauses(Clause* cl)
 
   TimeCounter tc(TC_UR_RESOLUTION);
 
+  _resultCnt = 0;
+
   ClauseList* res = 0;
-  processAndGetClauses(new Item(cl, _selectedOnly, *this, _emptyClauseOnly), 0, res);
+  {
+    Item itm(cl, _selectedOnly, *this, _emptyClauseOnly);
+    processAndGetClauses(itm, 0, res);
+  }
 
-  if(clen==1) {
+  if(clen==1 && !resultLimitReached()) {
     doBackwardInferences(cl, res);
   }
 
@@ -26,6 +26,8 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/Stack.hpp"
+
 #include "InferenceEngine.hpp"
 
 namespace Inferences
@@ -53,19 +55,27 @@ public:
 
 private:
   struct Item;
-  typedef List<Item*> ItemList;
 
-  void processAndGetClauses(Item* itm, unsigned startIdx, ClauseList*& acc);
+  void processAndGetClauses(Item& itm, unsigned startIdx, ClauseList*& acc);
 
-  void processLiteral(ItemList*& itms, unsigned idx);
+  void processLiteral(Item& itm, unsigned idx, ClauseList*& acc);
 
   void doBackwardInferences(Clause* cl, ClauseList*& acc);
 
+  bool resultLimitReached() const { return _resultLimit && _resultCnt>=_resultLimit; }
 
   bool _emptyClauseOnly;
   bool _selectedOnly;
   UnitClauseLiteralIndex* _unitIndex;
   NonUnitClauseLiteralIndex* _nonUnitIndex;
+
+  /** Maximal number of clauses per call to @c generateClauses(), zero means no limit */
+  unsigned _resultLimit;
+  /** Number of clauses generated so far by the current call to @c generateClauses() */
+  unsigned _resultCnt;
+
+  /** Literals of the items saved before each resolution step of the search */
+  Stack<Literal*> _litTrail;
 };
 
 };// namespace Inferences
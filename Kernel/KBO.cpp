@@ -28,6 +28,7 @@
 
 #include "Lib/Environment.hpp"
 #include "Lib/Comparison.hpp"
+#include "Lib/SwissMap.hpp"
 
 #include "Shell/Options.hpp"
 
@@ -84,7 +85,7 @@ private:
   }
 
   int _weightDiff;
-  DHMap<unsigned, int, IdentityHash> _varDiffs;
+  SwissMap<unsigned, int, IdentityHash> _varDiffs;
   /** Number of variables, that occur more times in the first literal */
   int _posNum;
   /** Number of variables, that occur more times in the second literal */
@@ -1008,11 +1008,13 @@ vstring RobSubstitution::toString(bool deref) const
 {
   CALL("RobSubstitution::toString");
   vstring res;
-  BankType::Iterator bit(_bank);
+  Stack<pair<VarSpec,TermSpec> > bindings;
+  _bank.collect(bindings);
+  Stack<pair<VarSpec,TermSpec> >::BottomFirstIterator bit(bindings);
   while(bit.hasNext()) {
-    VarSpec v;
-    TermSpec binding;
-    bit.next(v,binding);
+    pair<VarSpec,TermSpec> item=bit.next();
+    VarSpec v=item.first;
+    TermSpec binding=item.second;
     TermList tl;
     if(v.index==SPECIAL_INDEX) {
       res+="S"+Int::toString(v.var)+" -> ";
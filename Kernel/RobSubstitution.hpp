@@ -28,8 +28,10 @@
 #include <utility>
 
 #include "Forwards.hpp"
+#include "Lib/DArray.hpp"
 #include "Lib/DHMap.hpp"
 #include "Lib/Backtrackable.hpp"
+#include "Lib/Stack.hpp"
 #include "Term.hpp"
 
 #if VDEBUG
@@ -264,7 +266,128 @@ private:
   }
   static void swap(TermSpec& ts1, TermSpec& ts2);
 
-  typedef DHMap<VarSpec,TermSpec,VarSpec::Hash1, VarSpec::Hash2> BankType;
+  /**
+   * Storage of variable bindings.
+   *
+   * Variables of the first DENSE_BANKS ordinary banks (i.e. banks 0 and 1,
+   * which is what most inferences use) with numbers below DENSE_VAR_LIMIT
+   * are kept in arrays indexed directly by the variable number. The other
+   * variables (special, auxiliary, other banks or large numbers) go into
+   * a hash map.
+   *
+   * An array entry is valid only if its stamp equals @c _stamp, so that
+   * reset() does not need to touch the arrays.
+   */
+  class BankType
+  {
+  public:
+    BankType() : _stamp(1), _denseSize(0) {}
+
+    bool find(const VarSpec& v, TermSpec& res) const
+    {
+      if(isDense(v)) {
+        const DArray<Entry>& arr = _dense[v.index];
+        if(v.var>=arr.size() || arr[v.var].stamp!=_stamp) {
+          return false;
+        }
+        res = arr[v.var].binding;
+        return true;
+      }
+      return _other.find(v,res);
+    }
+    bool find(const VarSpec& v) const
+    {
+      TermSpec aux;
+      return find(v,aux);
+    }
+    void set(const VarSpec& v, const TermSpec& b)
+    {
+      if(isDense(v)) {
+        DArray<Entry>& arr = _dense[v.index];
+        if(v.var>=arr.size()) {
+          arr.expand(v.var+1);
+        }
+        Entry& e = arr[v.var];
+        if(e.stamp!=_stamp) {
+          e.stamp = _stamp;
+          _denseSize++;
+        }
+        e.binding = b;
+        return;
+      }
+      _other.set(v,b);
+    }
+    bool remove(const VarSpec& v)
+    {
+      if(isDense(v)) {
+        DArray<Entry>& arr = _dense[v.index];
+        if(v.var>=arr.size() || arr[v.var].stamp!=_stamp) {
+          return false;
+        }
+        arr[v.var].stamp = 0;
+        _denseSize--;
+        return true;
+      }
+      return _other.remove(v);
+    }
+    void reset()
+    {
+      _stamp++;
+      if(!_stamp) {
+        // the stamps wrapped around, entries with old stamps could become valid
+        for(unsigned b=0; b<DENSE_BANKS; b++) {
+          for(size_t i=0; i<_dense[b].size(); i++) {
+            _dense[b][i].stamp = 0;
+          }
+        }
+        _stamp = 1;
+      }
+      _denseSize = 0;
+      _other.reset();
+    }
+    size_t size() const { return _denseSize+_other.size(); }
+
+#if VDEBUG
+    /** Push all the bindings on @b acc */
+    void collect(Stack<pair<VarSpec,TermSpec> >& acc) const
+    {
+      for(unsigned b=0; b<DENSE_BANKS; b++) {
+        for(unsigned i=0; i<_dense[b].size(); i++) {
+          if(_dense[b][i].stamp==_stamp) {
+            acc.push(make_pair(VarSpec(i,b), _dense[b][i].binding));
+          }
+        }
+      }
+      DHMap<VarSpec,TermSpec,VarSpec::Hash1,VarSpec::Hash2>::Iterator it(_other);
+      while(it.hasNext()) {
+        VarSpec v;
+        TermSpec binding;
+        it.next(v,binding);
+        acc.push(make_pair(v,binding));
+      }
+    }
+#endif
+
+  private:
+    static const unsigned DENSE_BANKS = 2;
+    static const unsigned DENSE_VAR_LIMIT = 1024;
+
+    struct Entry
+    {
+      Entry() : stamp(0) {}
+      TermSpec binding;
+      /** the entry is valid iff this is equal to BankType::_stamp */
+      unsigned stamp;
+    };
+
+    static bool isDense(const VarSpec& v)
+    { return v.index>=0 && static_cast<unsigned>(v.index)<DENSE_BANKS && v.var<DENSE_VAR_LIMIT; }
+
+    DArray<Entry> _dense[DENSE_BANKS];
+    unsigned _stamp;
+    size_t _denseSize;
+    DHMap<VarSpec,TermSpec,VarSpec::Hash1,VarSpec::Hash2> _other;
+  };
 
   mutable BankType _bank;
 
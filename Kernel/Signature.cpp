@@ -210,6 +210,8 @@ Signature::Signature ():
     _foolConstantsDefined(false), _foolTrue(0), _foolFalse(0),
     _funs(32),
     _preds(32),
+    _nameCnt(0),
+    _internedNames(0),
     _nextFreshSymbolNumber(0),
     _skolemFunctionCount(0),
     _distinctGroupsAddedTo(false),
@@ -243,6 +245,7 @@ Signature::~Signature ()
   for (int i = _preds.length()-1;i >= 0;i--) {
     _preds[i]->destroyPredSymbol();
   }
+  List<vstring>::destroy(_internedNames);
 } // Signature::~Signature
 
 /**
@@ -261,15 +264,14 @@ unsigned Signature::addIntegerConstant(const vstring& number,bool defaultSort)
   }
 
   // default sort should be used
-  vstring name = value.toString();
-  vstring symbolKey = name + "_n";
-  unsigned result;
-  if (_funNames.find(symbolKey,result)) {
-    return result;
+  unsigned* pres;
+  if (!_integerConstants.getValuePtr(value.toInner(),pres)) {
+    return *pres;
   }
 
-  result = _funs.length();
-  Symbol* sym = new Symbol(name,0,false,false,true);
+  unsigned result = _funs.length();
+  *pres = result;
+  Symbol* sym = new Symbol(value.toString(),0,false,false,true);
   /*
   sym->addToDistinctGroup(INTEGER_DISTINCT_GROUP,result);
   if(defaultSort){ 
@@ -277,28 +279,25 @@ unsigned Signature::addIntegerConstant(const vstring& number,bool defaultSort)
   }
   */
   _funs.push(sym);
-  _funNames.insert(symbolKey,result);
   return result;
 } // Signature::addIntegerConstant
 
 /**
  * Add an integer constant to the signature.
- * @todo something smarter, so that we don't need to convert all values to string
  */
 unsigned Signature::addIntegerConstant(const IntegerConstantType& value)
 {
   CALL("Signature::addIntegerConstant");
 
-  vstring key = value.toString() + "_n";
-  unsigned result;
-  if (_funNames.find(key, result)) {
-    return result;
+  unsigned* pres;
+  if (!_integerConstants.getValuePtr(value.toInner(),pres)) {
+    return *pres;
   }
   _integers++;
-  result = _funs.length();
+  unsigned result = _funs.length();
+  *pres = result;
   Symbol* sym = new IntegerSymbol(value);
   _funs.push(sym);
-  _funNames.insert(key,result);
   /*
   sym->addToDistinctGroup(INTEGER_DISTINCT_GROUP,result);
   */
@@ -320,14 +319,13 @@ unsigned Signature::addRationalConstant(const vstring& numerator, const vstring&
     return addRationalConstant(value);
   }
 
-  vstring name = value.toString();
-  vstring key = name + "_q";
-  unsigned result;
-  if (_funNames.find(key,result)) {
-    return result;
+  unsigned* pres;
+  if (!_rationalConstants.getValuePtr(make_pair(value.numerator().toInner(),value.denominator().toInner()),pres)) {
+    return *pres;
   }
-  result = _funs.length();
-  Symbol* sym = new Symbol(name,0,false,false,true);
+  unsigned result = _funs.length();
+  *pres = result;
+  Symbol* sym = new Symbol(value.toString(),0,false,false,true);
   /*
   if(defaultSort){ 
     sym->addToDistinctGroup(STRING_DISTINCT_GROUP,result); // numbers are distinct from strings
@@ -335,7 +333,6 @@ unsigned Signature::addRationalConstant(const vstring& numerator, const vstring&
   sym->addToDistinctGroup(RATIONAL_DISTINCT_GROUP,result);
   */
   _funs.push(sym);
-  _funNames.insert(key,result);
   return result;
 } // addRatonalConstant
 
@@ -343,15 +340,14 @@ unsigned Signature::addRationalConstant(const RationalConstantType& value)
 {
   CALL("Signature::addRationalConstant");
 
-  vstring key = value.toString() + "_q";
-  unsigned result;
-  if (_funNames.find(key, result)) {
-    return result;
+  unsigned* pres;
+  if (!_rationalConstants.getValuePtr(make_pair(value.numerator().toInner(),value.denominator().toInner()),pres)) {
+    return *pres;
   }
   _rationals++;
-  result = _funs.length();
+  unsigned result = _funs.length();
+  *pres = result;
   _funs.push(new RationalSymbol(value));
-  _funNames.insert(key, result);
   return result;
 } // Signature::addRationalConstant
 
@@ -369,12 +365,12 @@ unsigned Signature::addRealConstant(const vstring& number,bool defaultSort)
   if (!defaultSort) {
     return addRealConstant(value);
   }
-  vstring key = value.toString() + "_r";
-  unsigned result;
-  if (_funNames.find(key,result)) {
-    return result;
+  unsigned* pres;
+  if (!_realConstants.getValuePtr(make_pair(value.numerator().toInner(),value.denominator().toInner()),pres)) {
+    return *pres;
   }
-  result = _funs.length();
+  unsigned result = _funs.length();
+  *pres = result;
   Symbol* sym = new Symbol(value.toNiceString(),0,false,false,true);
   /*
   if(defaultSort){ 
@@ -383,7 +379,6 @@ unsigned Signature::addRealConstant(const vstring& number,bool defaultSort)
   sym->addToDistinctGroup(REAL_DISTINCT_GROUP,result);
   */
   _funs.push(sym);
-  _funNames.insert(key,result);
   return result;
 } // addRealConstant
 
@@ -391,15 +386,14 @@ unsigned Signature::addRealConstant(const RealConstantType& value)
 {
   CALL("Signature::addRealConstant");
 
-  vstring key = value.toString() + "_r";
-  unsigned result;
-  if (_funNames.find(key, result)) {
-    return result;
+  unsigned* pres;
+  if (!_realConstants.getValuePtr(make_pair(value.numerator().toInner(),value.denominator().toInner()),pres)) {
+    return *pres;
   }
   _reals++;
-  result = _funs.length();
+  unsigned result = _funs.length();
+  *pres = result;
   _funs.push(new RealSymbol(value));
-  _funNames.insert(key, result);
   return result;
 }
 
@@ -546,7 +540,8 @@ bool Signature::functionExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::functionExists");
 
-  return _funNames.find(key(name, arity));
+  unsigned number;
+  return findFunction(name, arity, number);
 }
 
 /**
@@ -556,23 +551,73 @@ bool Signature::predicateExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::predicateExists");
 
-  return _predNames.find(key(name, arity));
+  unsigned number;
+  return findPredicate(name, arity, number);
 }
 
 unsigned Signature::getFunctionNumber(const vstring& name, unsigned arity) const
 {
   CALL("Signature::getFunctionNumber");
 
-  ASS(_funNames.find(key(name, arity)));
-  return _funNames.get(key(name, arity));
+  unsigned number;
+  ALWAYS(findFunction(name, arity, number));
+  return number;
 }
 
 unsigned Signature::getPredicateNumber(const vstring& name, unsigned arity) const
 {
   CALL("Signature::getPredicateNumber");
 
-  ASS(_predNames.find(key(name, arity)));
-  return _predNames.get(key(name, arity));
+  unsigned number;
+  ALWAYS(findPredicate(name, arity, number));
+  return number;
+}
+
+/**
+ * If @b name has been used as a name of a function or a predicate,
+ * assign its id to @b id and return true. Otherwise return false.
+ */
+bool Signature::findNameId(const vstring& name, unsigned& id) const
+{
+  CALL("Signature::findNameId");
+
+  return _nameIds.find(NameKey(name), id);
+}
+
+/**
+ * Return the id of a name, assigning a new one if the name has not been
+ * used yet. The @b name must be the unquoted name the symbol was added
+ * under, as that is what findFunction and findPredicate look up.
+ */
+unsigned Signature::internName(const vstring& name)
+{
+  CALL("Signature::internName");
+
+  unsigned id;
+  if (_nameIds.find(NameKey(name), id)) {
+    return id;
+  }
+  // the table refers to its keys, so it needs a copy of its own
+  List<vstring>::push(name, _internedNames);
+  id = _nameCnt++;
+  _nameIds.insert(NameKey(*_internedNames->headPtr()), id);
+  return id;
+}
+
+bool Signature::findFunction(const vstring& name, unsigned arity, unsigned& number) const
+{
+  CALL("Signature::findFunction");
+
+  unsigned nameId;
+  return findNameId(name, nameId) && _funIds.find(SymbolKey(nameId, arity), number);
+}
+
+bool Signature::findPredicate(const vstring& name, unsigned arity, unsigned& number) const
+{
+  CALL("Signature::findPredicate");
+
+  unsigned nameId;
+  return findNameId(name, nameId) && _predIds.find(SymbolKey(nameId, arity), number);
 }
 
 /**
@@ -591,9 +636,8 @@ unsigned Signature::addFunction (const vstring& name,
 {
   CALL("Signature::addFunction");
 
-  vstring symbolKey = key(name,arity);
   unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  if (findFunction(name,arity,result)) {
     added = false;
     getFunction(result)->unmarkIntroduced();
     return result;
@@ -612,8 +656,9 @@ unsigned Signature::addFunction (const vstring& name,
   }
 
   result = _funs.length();
-  _funs.push(new Symbol(name, arity, false, false, false, overflowConstant));
-  _funNames.insert(symbolKey, result);
+  Symbol* sym = new Symbol(name, arity, false, false, false, overflowConstant);
+  _funs.push(sym);
+  _funIds.insert(SymbolKey(internName(name), arity), result);
   added = true;
   return result;
 } // Signature::addFunction
@@ -662,9 +707,8 @@ unsigned Signature::addPredicate (const vstring& name,
 {
   CALL("Signature::addPredicate");
 
-  vstring symbolKey = key(name,arity);
   unsigned result;
-  if (_predNames.find(symbolKey,result)) {
+  if (findPredicate(name,arity,result)) {
     added = false;
     getPredicate(result)->unmarkIntroduced();
     return result;
@@ -683,8 +727,9 @@ unsigned Signature::addPredicate (const vstring& name,
   }
 
   result = _preds.length();
-  _preds.push(new Symbol(name,arity));
-  _predNames.insert(symbolKey,result);
+  Symbol* sym = new Symbol(name,arity);
+  _preds.push(sym);
+  _predIds.insert(SymbolKey(internName(name), arity), result);
   added = true;
   return result;
 } // Signature::addPredicate
@@ -427,9 +427,7 @@ class Signature
   /** return true iff predicate of given @b name and @b arity exists. */
   bool isPredicateName(vstring name, unsigned arity)
   {
-    vstring symbolKey = key(name,arity);
-    unsigned tmp;
-    return _predNames.find(symbolKey,tmp);
+    return predicateExists(name,arity);
   }
 
   /** return the number of functions */
@@ -531,15 +529,64 @@ private:
   Stack<Symbol*> _funs;
   /** Stack of predicate symbols */
   Stack<Symbol*> _preds;
+
+  /**
+   * Key of the table of symbol names. It only refers to a name, so
+   * that looking a name up does not copy it. Keys stored in the table
+   * refer to the copies kept in @b _internedNames.
+   */
+  struct NameKey
+  {
+    NameKey() : name(0) {}
+    explicit NameKey(const vstring& n) : name(&n) {}
+    bool operator==(const NameKey& o) const
+    { return name==o.name || (name && o.name && *name==*o.name); }
+    const vstring* name;
+  };
+  struct NameKeyHash
+  {
+    static unsigned hash(const NameKey& k) { return Hash::hash(*k.name); }
+  };
+  typedef pair<unsigned,unsigned> SymbolKey;
+
+  bool findNameId(const vstring& name, unsigned& id) const;
+  unsigned internName(const vstring& name);
+  bool findFunction(const vstring& name, unsigned arity, unsigned& number) const;
+  bool findPredicate(const vstring& name, unsigned arity, unsigned& number) const;
+
+  /** Map from names of functions and predicates to their ids */
+  DHMap<NameKey,unsigned,NameKeyHash,NameKeyHash> _nameIds;
+  /** Number of names in @b _nameIds */
+  unsigned _nameCnt;
+  /**
+   * Names in @b _nameIds as given to addFunction and addPredicate,
+   * that is, before the symbols quote them
+   */
+  List<vstring>* _internedNames;
+  /** Map from pairs (name id, arity) to function numbers */
+  DHMap<SymbolKey,unsigned> _funIds;
+  /** Map from pairs (name id, arity) to predicate numbers */
+  DHMap<SymbolKey,unsigned> _predIds;
   /**
-   * Map from vstring "name_arity" to their numbers
+   * Map from special keys of functions to their numbers
    *
-   * String constants have key "value_c", integer constants "value_n",
-   * rational "numerator_denominator_q" and real "value_r".
+   * String constants have key "value_c" and interpreted functions
+   * "name_i" followed by the interpretation.
    */
   SymbolMap _funNames;
-  /** Map from vstring "name_arity" to their numbers */
+  /** Map from special keys of interpreted predicates to their numbers */
   SymbolMap _predNames;
+  /**
+   * Map from values of integer constants to their numbers
+   *
+   * An integer constant of the default sort and an interpreted one with
+   * the same value share the entry (the same holds for the maps below).
+   */
+  DHMap<int,unsigned> _integerConstants;
+  /** Map from (numerator, denominator) of rational constants to their numbers */
+  DHMap<pair<int,int>,unsigned> _rationalConstants;
+  /** Map from (numerator, denominator) of real constants to their numbers */
+  DHMap<pair<int,int>,unsigned> _realConstants;
   /** Map for the arity_check options: maps symbols to their arities */
   SymbolMap _arityCheck;
   /** Last number used for fresh functions and predicates */
@@ -78,19 +78,19 @@ bool SubtermIterator::hasNext()
 {
   CALL("SubtermIterator::hasNext");
 
-  if(_stack->isEmpty()) {
+  if(_stack.isEmpty()) {
     return false;
   }
   if(!_used) {
     return true;
   }
   _used=false;
-  const TermList* t=_stack->pop();
+  const TermList* t=_stack.pop();
   pushNext(t->next());
   if(t->isTerm()) {
     pushNext(t->term()->args());
   }
-  return !_stack->isEmpty();
+  return !_stack.isEmpty();
 }
 
 /**
@@ -102,11 +102,11 @@ bool SubtermIterator::hasNext()
 void SubtermIterator::right()
 {
   CALL("SubtermIterator::right");
-  ASS(_stack->isNonEmpty());
+  ASS(_stack.isNonEmpty());
   ASS(_used);
 
   _used=false;
-  const TermList* t=_stack->pop();
+  const TermList* t=_stack.pop();
   pushNext(t->next());
 
   //we did here the same as in the hasNext function, we only didn't call
@@ -277,7 +277,6 @@ bool DisagreementSetIterator::hasNext()
  * @since 26/05/2007 Manchester
  */
 TermFunIterator::TermFunIterator (const Term* t)
-  : _stack(64)
 {
   CALL("TermFunIterator::TermFunIterator");
 
@@ -339,7 +338,6 @@ unsigned TermFunIterator::next ()
  * Build an iterator over variables of t.
  */
 TermVarIterator::TermVarIterator (const Term* t)
-  : _stack(64)
 {
   CALL("TermVarIterator::TermVarIterator");
 
@@ -352,7 +350,6 @@ TermVarIterator::TermVarIterator (const Term* t)
  * @since 26/05/2007 Manchester, reimplemented
  */
 TermVarIterator::TermVarIterator (const TermList* ts)
-  : _stack(64)
 {
   CALL("TermVarIterator::TermVarIterator");
   _stack.push(ts);
@@ -26,6 +26,7 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/InlineStack.hpp"
 #include "Lib/Recycler.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/VirtualIterator.hpp"
@@ -44,16 +45,16 @@ class VariableIterator
 {
 public:
   DECL_ELEMENT_TYPE(TermList);
-  VariableIterator() : _stack(8), _used(false) {}
+  VariableIterator() : _used(false) {}
 
-  VariableIterator(const Term* term) : _stack(8), _used(false)
+  VariableIterator(const Term* term) : _used(false)
   {
     if(!term->shared() || !term->ground()) {
       _stack.push(term->args());
     }
   }
 
-  VariableIterator(TermList t) : _stack(8), _used(false)
+  VariableIterator(TermList t) : _used(false)
   {
     if(t.isVar()) {
       _aux[0].makeEmpty();
@@ -106,7 +107,7 @@ public:
     return *_stack.top();
   }
 private:
-  Stack<const TermList*> _stack;
+  InlineStack<const TermList*,16> _stack;
   bool _used;
   TermList _aux[2];
 };
@@ -151,24 +152,17 @@ class SubtermIterator
 public:
   SubtermIterator(const Term* term) : _used(false)
   {
-    Recycler::get(_stack);
-    _stack->reset();
-
     pushNext(term->args());
   }
-  ~SubtermIterator()
-  {
-    Recycler::release(_stack);
-  }
 
   bool hasNext();
   /** Return next subterm
    * @warning hasNext() must have been called before */
   TermList next()
   {
-    ASS(!_used && !_stack->isEmpty());
+    ASS(!_used && !_stack.isEmpty());
     _used=true;
-    return *_stack->top();
+    return *_stack.top();
   }
 
   /**
@@ -177,21 +171,17 @@ public:
    */
   void right();
 protected:
-  SubtermIterator() : _used(false)
-  {
-    Recycler::get(_stack);
-    _stack->reset();
-  }
+  SubtermIterator() : _used(false) {}
 
   inline
   void pushNext(const TermList* t)
   {
     if(!t->isEmpty()) {
-      _stack->push(t);
+      _stack.push(t);
     }
   }
 
-  Stack<const TermList*>* _stack;
+  InlineStack<const TermList*,16> _stack;
   bool _used;
 };
 
@@ -215,8 +205,8 @@ public:
     aux[2]=*trm->nthArgument(0);
     aux[3].makeEmpty();
 
-    _stack->push(&aux[0]);
-    _stack->push(&aux[2]);
+    _stack.push(&aux[0]);
+    _stack.push(&aux[2]);
   }
 private:
   TermList aux[4];
@@ -231,7 +221,7 @@ class PolishSubtermIterator
 : public IteratorCore<TermList>
 {
 public:
-  PolishSubtermIterator(const Term* term) : _stack(8), _used(false)
+  PolishSubtermIterator(const Term* term) : _used(false)
   {
     pushNext(term->args());
   }
@@ -257,7 +247,7 @@ private:
       t=t->term()->args();
     }
   }
-  Stack<const TermList*> _stack;
+  InlineStack<const TermList*,16> _stack;
   bool _used;
 };
 
@@ -277,8 +267,7 @@ public:
    * @author Andrei Voronkov
    */
   NonVariableIterator(Term* term,bool includeSelf=false)
-  : _stack(8),
-    _added(0)
+  : _added(0)
   {
     CALL("NonVariableIterator::NonVariableIterator");
     _stack.push(term);
@@ -294,7 +283,7 @@ public:
   void right();
 private:
   /** available non-variable subterms */
-  Stack<Term*> _stack;
+  InlineStack<Term*,16> _stack;
   /** the number of non-variable subterms added at the last iteration, used by right() */
   int _added;
 }; // NonVariableIterator
@@ -321,7 +310,6 @@ public:
    * Create an iterator over the disagreement set of two terms
    */
   DisagreementSetIterator(TermList t1, TermList t2, bool disjunctVariables=true)
-  : _stack(8)
   {
     CALL("Term::DisagreementSetIterator::DisagreementSetIterator(TermList...)");
     reset(t1, t2, disjunctVariables);
@@ -331,7 +319,7 @@ public:
    * with the same top functor
    */
   DisagreementSetIterator(Term* t1, Term* t2, bool disjunctVariables=true)
-  : _stack(8), _disjunctVariables(disjunctVariables)
+  : _disjunctVariables(disjunctVariables)
   {
     CALL("Term::DisagreementSetIterator::DisagreementSetIterator(Term*...)");
     reset(t1,t2,disjunctVariables);
@@ -383,7 +371,7 @@ public:
     return res;
   }
 private:
-  Stack<TermList*> _stack;
+  InlineStack<TermList*,16> _stack;
   bool _disjunctVariables;
   TermList _arg1;
   TermList _arg2;
@@ -411,7 +399,7 @@ private:
   /** next symbol, previously found */
   unsigned _next;
   /** Stack of term lists (not terms!) */
-  Stack<const TermList*> _stack;
+  InlineStack<const TermList*,16> _stack;
 }; // class TermFunIterator
 
 
@@ -435,7 +423,7 @@ private:
   /** next variable, previously found */
   unsigned _next;
   /** Stack of term lists (not terms!) */
-  Stack<const TermList*> _stack;
+  InlineStack<const TermList*,16> _stack;
 }; // class TermVarIterator
 
 
@@ -105,14 +105,29 @@ bool Environment::timeLimitReached() const
 {
   CALL("Environment::timeLimitReached");
 
-  if (options->timeLimitInDeciseconds() &&
-      timer->elapsedDeciseconds() > options->timeLimitInDeciseconds()) {
+  // the flag is maintained by the timer, so in the common case
+  // no clock needs to be read
+  if (!Timer::limitFlagged()) {
+    return false;
+  }
+  if (timeLimitPassed()) {
     statistics->terminationReason = Shell::Statistics::TIME_LIMIT;
     return true;
   }
   return false;
 } // Environment::timeLimitReached
 
+/**
+ * Return true if the global time limit is set and the timer shows
+ * it has passed. Unlike timeLimitReached(), this does not consult
+ * the timer flag and has no side effects.
+ */
+bool Environment::timeLimitPassed() const
+{
+  return options->timeLimitInDeciseconds() &&
+      timer->elapsedDeciseconds() > options->timeLimitInDeciseconds();
+} // Environment::timeLimitPassed
+
 
 /**
  * Return remaining time in miliseconds.
@@ -79,6 +79,7 @@ public:
   ostream* getPriorityOutput() { return _priorityOutput; }
 
   bool timeLimitReached() const;
+  bool timeLimitPassed() const;
 
   template<int Period>
   void checkTimeSometime() const
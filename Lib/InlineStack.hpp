@@ -0,0 +1,143 @@
+/*
+ * File InlineStack.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+/**
+ * @file InlineStack.hpp
+ * Defines class template InlineStack<C,N>, a stack that keeps its first
+ * N elements inside the object.
+ */
+
+#ifndef __InlineStack__
+#define __InlineStack__
+
+#include <cstring>
+
+#include "Forwards.hpp"
+
+#include "Debug/Assertion.hpp"
+#include "Debug/Tracer.hpp"
+
+#include "Allocator.hpp"
+
+namespace Lib {
+
+/**
+ * Stack of elements of class C that stores up to N elements in a buffer
+ * inside the object and moves to the heap only when it grows beyond that.
+ * It is meant for the traversal stacks of short-lived iterators, which
+ * are created very often and almost never need more than a few entries.
+ *
+ * Elements are moved with memcpy and never destroyed, so C must be
+ * trivially copyable (in practice C is a pointer type).
+ */
+template<typename C, unsigned N>
+class InlineStack
+{
+public:
+  CLASS_NAME(InlineStack);
+  USE_ALLOCATOR(InlineStack);
+
+  InlineStack()
+  : _stack(_inline), _cursor(_inline), _end(_inline+N) {}
+
+  InlineStack(const InlineStack& s)
+  : _stack(_inline), _cursor(_inline), _end(_inline+N)
+  {
+    *this = s;
+  }
+
+  ~InlineStack()
+  {
+    if(_stack!=_inline) {
+      DEALLOC_KNOWN(_stack,capacity()*sizeof(C),className());
+    }
+  }
+
+  InlineStack& operator=(const InlineStack& s)
+  {
+    if(this==&s) {
+      return *this;
+    }
+    size_t sz=s.size();
+    _cursor=_stack;
+    while(capacity()<sz) {
+      expand();
+    }
+    memcpy(_stack,s._stack,sz*sizeof(C));
+    _cursor=_stack+sz;
+    return *this;
+  }
+
+  inline bool isEmpty() const { return _cursor==_stack; }
+  inline bool isNonEmpty() const { return _cursor!=_stack; }
+  inline size_t size() const { return _cursor-_stack; }
+
+  /** Empty the stack, the memory obtained so far is kept */
+  inline void reset() { _cursor=_stack; }
+
+  inline C& top() const
+  {
+    ASS_G(_cursor,_stack);
+    return _cursor[-1];
+  }
+
+  inline void push(C elem)
+  {
+    if(_cursor==_end) {
+      expand();
+    }
+    *_cursor++=elem;
+  }
+
+  inline C pop()
+  {
+    ASS_G(_cursor,_stack);
+    return *--_cursor;
+  }
+
+private:
+  inline size_t capacity() const { return _end-_stack; }
+
+  /** Double the capacity, moving the elements to the heap */
+  void expand()
+  {
+    CALL("InlineStack::expand");
+
+    size_t cap=capacity();
+    size_t sz=size();
+    C* mem=static_cast<C*>(ALLOC_KNOWN(2*cap*sizeof(C),className()));
+    memcpy(mem,_stack,sz*sizeof(C));
+    if(_stack!=_inline) {
+      DEALLOC_KNOWN(_stack,cap*sizeof(C),className());
+    }
+    _stack=mem;
+    _cursor=mem+sz;
+    _end=mem+2*cap;
+  }
+
+  /** the bottom of the stack, either _inline or heap memory */
+  C* _stack;
+  /** the first free position */
+  C* _cursor;
+  /** the end of the memory pointed to by _stack */
+  C* _end;
+  C _inline[N];
+}; // class InlineStack
+
+}
+
+#endif // __InlineStack__
@@ -32,6 +32,7 @@
 #include "Debug/Tracer.hpp"
 
 #include "Allocator.hpp"
+#include "DHMap.hpp"
 #include "Metaiterators.hpp"
 #include "Set.hpp"
 #include "Sort.hpp"
@@ -124,6 +125,24 @@ public:
       return s;
     }
 
+    // both operands are shared, so the union of a given pair of
+    // pointers never changes and can be memoised; the key is
+    // normalised as the union is commutative
+    UnionCacheKey key = (this<s) ? UnionCacheKey(this,s) : UnionCacheKey(s,this);
+    const SharedSet* cached;
+    if(getUnionCache().find(key,cached)) {
+      return cached;
+    }
+    const SharedSet* res=computeUnion(s);
+    getUnionCache().insert(key,res);
+    return res;
+  }
+
+private:
+  const SharedSet* computeUnion(const SharedSet* s) const
+  {
+    CALL("SharedSet::computeUnion");
+
     bool p1Superset = true;
     bool p2Superset = true;
 
@@ -177,6 +196,7 @@ public:
     return res;
   }
 
+public:
   const SharedSet* getIntersection(const SharedSet* s) const
   {
     CALL("SharedSet::getIntersection");
@@ -537,6 +557,20 @@ private:
     return sstruct;
   }
 
+  typedef pair<const SharedSet*,const SharedSet*> UnionCacheKey;
+  typedef DHMap<UnionCacheKey,const SharedSet*,PtrPairSimpleHash> UnionCache;
+
+  /**
+   * Results of getUnion for pairs of non-trivial operands. Shared sets
+   * are never deleted before the end of the run, so the cached
+   * pointers remain valid.
+   */
+  static UnionCache& getUnionCache()
+  {
+    static UnionCache cache;
+    return cache;
+  }
+
 public:
 
   static bool equals(const SharedSet* s1,const SharedSet* s2)
@@ -0,0 +1,497 @@
+
+/*
+ * File SwissMap.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+/**
+ * @file SwissMap.hpp
+ * Defines class templates SwissMap<Key,Val,Hash> and SwissSet<Val,Hash>,
+ * open addressing hash tables with one control byte per slot that are
+ * probed a group of slots at a time.
+ */
+
+#ifndef __SwissMap__
+#define __SwissMap__
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "Forwards.hpp"
+
+#include "Debug/Assertion.hpp"
+#include "Debug/Tracer.hpp"
+
+#include "Allocator.hpp"
+#include "Hash.hpp"
+
+namespace Lib {
+
+/**
+ * Class SwissMap implements maps with keys of class Key and values of
+ * class Val. It offers the parts of the DHMap interface used on hot paths
+ * (insert, set, find, getValuePtr, remove, reset and iteration), so that
+ * a DHMap can be replaced by a SwissMap at a single call site.
+ *
+ * Slots are kept in an array whose size is a power of two. Next to it is
+ * an array of control bytes, one per slot: CTRL_EMPTY for a free slot, or
+ * the low 7 bits of the key hash for an occupied one. A lookup compares
+ * a whole group of GROUP_SIZE control bytes with the hash byte at once
+ * (with SSE2 where available) and only looks at the keys of matching
+ * slots. The first GROUP_SIZE-1 control bytes are mirrored after the end
+ * of the array so that a group can start at any slot.
+ *
+ * Collisions are resolved by linear probing, and remove() shifts the
+ * following entries of the probe run back, so no tombstones are ever
+ * left behind and lookups never get slower after many removals.
+ *
+ * @param Key anything that can be hashed using Hash and compared using ==
+ * @param Val values, can be anything
+ * @param Hash class containing a function hash() mapping keys to unsigned
+ *        integers. The result is mixed before use, so even an identity
+ *        hash spreads well.
+ */
+template <typename Key, typename Val, class Hash=FIRST_HASH(Key)>
+class SwissMap
+{
+public:
+  CLASS_NAME(SwissMap);
+  USE_ALLOCATOR(SwissMap);
+
+  SwissMap()
+  : _size(0), _capacity(0), _ctrl(0), _entries(0)
+  {
+    expand();
+  }
+
+  ~SwissMap()
+  {
+    CALL("SwissMap::~SwissMap");
+
+    destroyEntries();
+    DEALLOC_KNOWN(_ctrl,ctrlSize(_capacity),"SwissMap::ctrl");
+    DEALLOC_KNOWN(_entries,_capacity*sizeof(Entry),"SwissMap::Entry");
+  }
+
+  /**
+   * Empty the map
+   *
+   * Only the control bytes are cleared (plus a destructor call per entry
+   * for non-trivially destructible keys or values), the slots themselves
+   * are not touched.
+   */
+  void reset()
+  {
+    CALL("SwissMap::reset");
+
+    if(!_size) {
+      return;
+    }
+    destroyEntries();
+    memset(_ctrl, CTRL_EMPTY, ctrlSize(_capacity));
+    _size = 0;
+  }
+
+  /** Return the number of entries in the map */
+  unsigned size() const { return _size; }
+  /** Return true iff the map is empty */
+  bool isEmpty() const { return !_size; }
+
+  /** Return true iff there is an entry for @b key */
+  bool find(Key key) const
+  {
+    return findIndex(key)!=NOT_FOUND;
+  }
+
+  /**
+   * If there is an entry for @b key, assign its value to @b val and
+   * return true, otherwise return false
+   */
+  bool find(Key key, Val& val) const
+  {
+    unsigned idx = findIndex(key);
+    if(idx==NOT_FOUND) {
+      return false;
+    }
+    val = _entries[idx].val;
+    return true;
+  }
+
+  /** Return pointer to the value stored for @b key, or 0 if there is none */
+  Val* findPtr(Key key)
+  {
+    unsigned idx = findIndex(key);
+    return idx==NOT_FOUND ? 0 : &_entries[idx].val;
+  }
+
+  /** Return the value stored for @b key, which must be in the map */
+  Val& get(Key key)
+  {
+    unsigned idx = findIndex(key);
+    ASS_NEQ(idx,NOT_FOUND);
+    return _entries[idx].val;
+  }
+
+  /**
+   * If there is no entry for @b key, insert it with value @b val and
+   * return true. Otherwise leave the map unchanged and return false.
+   */
+  bool insert(Key key, const Val& val)
+  {
+    CALL("SwissMap::insert");
+
+    Val* pval;
+    if(!getValuePtr(key, pval, val)) {
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Assign @b val to @b key. Return true iff @b key was not in the map
+   * before.
+   */
+  bool set(Key key, const Val& val)
+  {
+    CALL("SwissMap::set");
+
+    Val* pval;
+    if(getValuePtr(key, pval, val)) {
+      return true;
+    }
+    *pval = val;
+    return false;
+  }
+
+  /**
+   * Assign to @b pval a pointer to the value stored for @b key. If there
+   * is no entry for @b key, create one with value @b initial and return
+   * true, otherwise return false.
+   */
+  bool getValuePtr(Key key, Val*& pval, const Val& initial)
+  {
+    CALL("SwissMap::getValuePtr");
+
+    unsigned h = mix(key);
+    unsigned idx = findIndex(key, h);
+    if(idx!=NOT_FOUND) {
+      pval = &_entries[idx].val;
+      return false;
+    }
+    if((_size+1)*8 > _capacity*7) {
+      expand();
+    }
+    idx = insertNew(key, h, initial);
+    pval = &_entries[idx].val;
+    return true;
+  }
+
+  /** Like getValuePtr(key,pval,initial) with a default-constructed initial value */
+  bool getValuePtr(Key key, Val*& pval)
+  {
+    return getValuePtr(key, pval, Val());
+  }
+
+  /** Remove the entry for @b key and return true, or return false if there is none */
+  bool remove(Key key)
+  {
+    CALL("SwissMap::remove");
+
+    unsigned idx = findIndex(key);
+    if(idx==NOT_FOUND) {
+      return false;
+    }
+    _entries[idx].~Entry();
+    _size--;
+
+    // backward shift: move every entry of the rest of the probe run that
+    // may live at the freed slot there, until an empty slot is reached
+    unsigned mask = _capacity-1;
+    unsigned hole = idx;
+    for(unsigned j = (idx+1)&mask; _ctrl[j]!=CTRL_EMPTY; j = (j+1)&mask) {
+      unsigned home = mix(_entries[j].key)&mask;
+      // the entry at j can move to hole iff its home is not cyclically in (hole,j]
+      bool canMove = hole<=j ? (home<=hole || home>j) : (home<=hole && home>j);
+      if(canMove) {
+        ::new(&_entries[hole]) Entry(_entries[j]);
+        _entries[j].~Entry();
+        setCtrl(hole, _ctrl[j]);
+        hole = j;
+      }
+    }
+    setCtrl(hole, CTRL_EMPTY);
+    return true;
+  }
+
+  /**
+   * Iterator over the entries of the map
+   *
+   * The map must not be modified while an iterator is in use.
+   */
+  class Iterator
+  {
+  public:
+    explicit Iterator(const SwissMap& map) : _map(map), _idx(0) { skipEmpty(); }
+
+    bool hasNext() const { return _idx<_map._capacity; }
+
+    Val next()
+    {
+      ASS(hasNext());
+      Val res = _map._entries[_idx].val;
+      _idx++;
+      skipEmpty();
+      return res;
+    }
+
+    Key nextKey()
+    {
+      ASS(hasNext());
+      Key res = _map._entries[_idx].key;
+      _idx++;
+      skipEmpty();
+      return res;
+    }
+
+    void next(Key& key, Val& val)
+    {
+      ASS(hasNext());
+      key = _map._entries[_idx].key;
+      val = _map._entries[_idx].val;
+      _idx++;
+      skipEmpty();
+    }
+  private:
+    void skipEmpty()
+    {
+      while(_idx<_map._capacity && _map._ctrl[_idx]==CTRL_EMPTY) {
+        _idx++;
+      }
+    }
+
+    const SwissMap& _map;
+    unsigned _idx;
+  };
+
+private:
+  SwissMap(const SwissMap&);
+  SwissMap& operator=(const SwissMap&);
+
+  struct Entry
+  {
+    Entry(Key key, const Val& val) : key(key), val(val) {}
+    Key key;
+    Val val;
+  };
+
+  enum {
+    /** number of control bytes compared at once */
+    GROUP_SIZE = 16,
+    /** the initial capacity, must be a power of two */
+    MIN_CAPACITY = 16
+  };
+  // enumerators rather than static const members, so that they need no
+  // out-of-class definition when bound to a reference (as by ASS_NEQ)
+  enum {
+    /** control byte of a free slot */
+    CTRL_EMPTY = 0x80
+  };
+  enum : unsigned {
+    /** returned by findIndex() for a missing key */
+    NOT_FOUND = 0xFFFFFFFF
+  };
+
+  static size_t ctrlSize(unsigned capacity) { return capacity+GROUP_SIZE-1; }
+
+  /** Hash of @b key with its bits well spread */
+  static unsigned mix(Key& key)
+  {
+    unsigned h = Hash::hash(key);
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h;
+  }
+  /** The control byte of an occupied slot with hash @b h */
+  static unsigned char h2(unsigned h) { return static_cast<unsigned char>(h >> 25); }
+  /** The preferred slot of an entry with hash @b h */
+  unsigned h1(unsigned h) const { return h & (_capacity-1); }
+
+  /** Return a bit mask of the bytes in the group starting at @b p that are equal to @b b */
+  static unsigned matchByte(const unsigned char* p, unsigned char b)
+  {
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(b)))));
+#else
+    unsigned res = 0;
+    for(unsigned i=0; i<GROUP_SIZE; i++) {
+      if(p[i]==b) {
+        res |= 1u << i;
+      }
+    }
+    return res;
+#endif
+  }
+
+  /** Set control byte of slot @b idx, together with its mirror */
+  void setCtrl(unsigned idx, unsigned char c)
+  {
+    _ctrl[idx] = c;
+    if(idx<GROUP_SIZE-1) {
+      _ctrl[_capacity+idx] = c;
+    }
+  }
+
+  unsigned findIndex(Key key) const
+  {
+    return findIndex(key, mix(key));
+  }
+
+  unsigned findIndex(Key& key, unsigned h) const
+  {
+    unsigned mask = _capacity-1;
+    unsigned char tag = h2(h);
+    unsigned pos = h1(h);
+    for(;;) {
+      const unsigned char* group = _ctrl+pos;
+      unsigned matches = matchByte(group, tag);
+      while(matches) {
+        unsigned bit = __builtin_ctz(matches);
+        unsigned idx = (pos+bit)&mask;
+        if(_entries[idx].key==key) {
+          return idx;
+        }
+        matches &= matches-1;
+      }
+      if(matchByte(group, CTRL_EMPTY)) {
+        return NOT_FOUND;
+      }
+      pos = (pos+GROUP_SIZE)&mask;
+    }
+  }
+
+  /** Put a new entry into the first empty slot of the probe sequence of @b h */
+  unsigned insertNew(Key& key, unsigned h, const Val& val)
+  {
+    unsigned mask = _capacity-1;
+    unsigned pos = h1(h);
+    for(;;) {
+      unsigned empties = matchByte(_ctrl+pos, CTRL_EMPTY);
+      if(empties) {
+        unsigned idx = (pos+__builtin_ctz(empties))&mask;
+        ::new(&_entries[idx]) Entry(key, val);
+        setCtrl(idx, h2(h));
+        _size++;
+        return idx;
+      }
+      pos = (pos+GROUP_SIZE)&mask;
+    }
+  }
+
+  void destroyEntries()
+  {
+    if(std::is_trivially_destructible<Entry>::value) {
+      return;
+    }
+    for(unsigned i=0; i<_capacity; i++) {
+      if(_ctrl[i]!=CTRL_EMPTY) {
+        _entries[i].~Entry();
+      }
+    }
+  }
+
+  /** Double the capacity (or allocate the initial one) and rehash */
+  void expand()
+  {
+    CALL("SwissMap::expand");
+
+    unsigned oldCapacity = _capacity;
+    unsigned char* oldCtrl = _ctrl;
+    Entry* oldEntries = _entries;
+
+    _capacity = oldCapacity ? oldCapacity*2 : MIN_CAPACITY;
+    _ctrl = static_cast<unsigned char*>(ALLOC_KNOWN(ctrlSize(_capacity),"SwissMap::ctrl"));
+    memset(_ctrl, CTRL_EMPTY, ctrlSize(_capacity));
+    _entries = static_cast<Entry*>(ALLOC_KNOWN(_capacity*sizeof(Entry),"SwissMap::Entry"));
+    _size = 0;
+
+    if(!oldCapacity) {
+      return;
+    }
+    for(unsigned i=0; i<oldCapacity; i++) {
+      if(oldCtrl[i]!=CTRL_EMPTY) {
+        Entry& e = oldEntries[i];
+        insertNew(e.key, mix(e.key), e.val);
+        e.~Entry();
+      }
+    }
+    DEALLOC_KNOWN(oldCtrl,ctrlSize(oldCapacity),"SwissMap::ctrl");
+    DEALLOC_KNOWN(oldEntries,oldCapacity*sizeof(Entry),"SwissMap::Entry");
+  }
+
+  unsigned _size;
+  /** number of slots, a power of two */
+  unsigned _capacity;
+  /** control bytes, ctrlSize(_capacity) of them */
+  unsigned char* _ctrl;
+  Entry* _entries;
+};
+
+/**
+ * Class SwissSet implements sets of values of class Val on top of
+ * SwissMap, offering the DHSet operations used on hot paths.
+ */
+template <typename Val, class Hash=FIRST_HASH(Val)>
+class SwissSet
+{
+public:
+  CLASS_NAME(SwissSet);
+  USE_ALLOCATOR(SwissSet);
+
+  /** Empty the set */
+  void reset() { _map.reset(); }
+  /** Return the number of elements of the set */
+  unsigned size() const { return _map.size(); }
+  /** Return true iff the set is empty */
+  bool isEmpty() const { return _map.isEmpty(); }
+  /** Return true iff @b val is in the set */
+  bool find(Val val) const { return _map.find(val); }
+  /** Add @b val to the set, return true iff it was not there before */
+  bool insert(Val val) { return _map.insert(val, EmptyStruct()); }
+  /** Remove @b val from the set, return true iff it was there */
+  bool remove(Val val) { return _map.remove(val); }
+
+  class Iterator
+  {
+  public:
+    explicit Iterator(const SwissSet& set) : _it(set._map) {}
+    bool hasNext() const { return _it.hasNext(); }
+    Val next() { return _it.nextKey(); }
+  private:
+    typename SwissMap<Val,EmptyStruct,Hash>::Iterator _it;
+  };
+private:
+  SwissMap<Val,EmptyStruct,Hash> _map;
+};
+
+}
+
+#endif // __SwissMap__
@@ -181,6 +181,33 @@ void TimeCounter::printReport(ostream& out)
   out<<endl;
 }
 
+/**
+ * Print a JSON object mapping the names of the counters that measured
+ * some time to their times in milliseconds.
+ */
+void TimeCounter::printSnapshot(ostream& out)
+{
+  CALL("TimeCounter::printSnapshot");
+
+  snapShot();
+
+  out << '{';
+  bool first = true;
+  for (int i=0; i<__TC_ELEMENT_COUNT; i++) {
+    if (!s_measuredTimes[i]) {
+      continue;
+    }
+    if (!first) {
+      out << ',';
+    }
+    first = false;
+    out << '"';
+    outputUnitName(static_cast<TimeCounterUnit>(i), out);
+    out << "\":" << s_measuredTimes[i];
+  }
+  out << '}';
+}
+
 void TimeCounter::outputSingleStat(TimeCounterUnit tcu, ostream& out)
 {
   if (s_measureInitTimes[tcu]==-1 && !s_measuredTimes[tcu]) {
@@ -188,6 +215,22 @@ void TimeCounter::outputSingleStat(TimeCounterUnit tcu, ostream& out)
   }
 
   addCommentSignForSZS(out);
+  outputUnitName(tcu, out);
+  out<<": ";
+
+  Timer::printMSString(out, s_measuredTimes[tcu]);
+
+  if (s_measuredTimesChildren[tcu] > 0) {
+    out << " ( own ";
+    Timer::printMSString(out, s_measuredTimes[tcu]-s_measuredTimesChildren[tcu]);
+    out << " ) ";
+  }
+  
+  out<<endl;
+}
+
+void TimeCounter::outputUnitName(TimeCounterUnit tcu, ostream& out)
+{
   switch(tcu) {
   case TC_RAND_OPT:
     out << "random option generation";
@@ -411,16 +454,5 @@ void TimeCounter::outputSingleStat(TimeCounterUnit tcu, ostream& out)
   default:
     ASSERTION_VIOLATION;
   }
-  out<<": ";
-
-  Timer::printMSString(out, s_measuredTimes[tcu]);
-
-  if (s_measuredTimesChildren[tcu] > 0) {
-    out << " ( own ";
-    Timer::printMSString(out, s_measuredTimes[tcu]-s_measuredTimesChildren[tcu]);
-    out << " ) ";
-  }
-  
-  out<<endl;
 }
 
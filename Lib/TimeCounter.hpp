@@ -125,6 +125,7 @@ public:
   }
 
   static void printReport(ostream& out);
+  static void printSnapshot(ostream& out);
 
 
   /**
@@ -151,6 +152,7 @@ private:
 
   static void initialize();
   static void outputSingleStat(TimeCounterUnit tcu, ostream& out);
+  static void outputUnitName(TimeCounterUnit tcu, ostream& out);
 
   /**
    * Record measurements of all timers currently running,
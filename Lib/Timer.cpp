@@ -66,6 +66,10 @@ int timer_sigalrm_counter=-1;
 
 int Timer::s_ticksPerSec;
 int Timer::s_initGuarantedMiliseconds;
+volatile sig_atomic_t Timer::s_limitFlag = 0;
+
+/** number of ticks between two clock resynchronisations in the signal handler */
+#define TIMER_RESYNC_PERIOD 256
 
 
 void timeLimitReached()
@@ -111,6 +115,16 @@ timer_sigalrm_handler (int sig)
 
   timer_sigalrm_counter++;
 
+  // times() is async-signal-safe, so the drift of the tick counter is
+  // corrected here rather than by polling syncClock() in the main loops
+  static int ticksToResync = TIMER_RESYNC_PERIOD;
+  if(!--ticksToResync) {
+    ticksToResync = TIMER_RESYNC_PERIOD;
+    Timer::resyncClock();
+  }
+
+  Timer::s_limitFlag = env.timeLimitPassed();
+
   if(Timer::s_timeLimitEnforcement && env.timeLimitReached()) {
     timeLimitReached();
   }
@@ -217,32 +231,32 @@ void Lib::Timer::deinitializeTimer()
   signal (SIGALRM, SIG_IGN); // unregister the handler (and ignore the rest of SIGALRMs, should they still come) 
 }
 
-void Lib::Timer::syncClock()
+/**
+ * Set the tick counter to the time obtained from the system if the
+ * two differ too much. Return false if the system time is not available.
+ */
+bool Lib::Timer::resyncClock()
 {
   if(s_initGuarantedMiliseconds==-1) {
-    //we're unable to sync clock as we weren't able to obtain number of ticks in the beginning
-    bool reportedProblem = false;
-    if(!reportedProblem) {
-      reportedProblem = true;
-      cerr << "cannot syncronize clock as times() initially returned -1" << endl;
-    }
-    return;
+    return false;
   }
   int newMilliseconds = guaranteedMilliseconds();
   if(newMilliseconds==-1) {
-    //we're unable to sync clock as we cannot get the current time
-    bool reportedProblem = false;
-    if(!reportedProblem) {
-      reportedProblem = true;
-      cerr << "could not syncronize clock as times() returned -1" << endl;
-    }
-    return;
+    return false;
   }
 
   int newVal=newMilliseconds-s_initGuarantedMiliseconds;
   if(abs(newVal-timer_sigalrm_counter)>20) {
     timer_sigalrm_counter=newVal;
   }
+  return true;
+}
+
+void Lib::Timer::syncClock()
+{
+  if(!resyncClock()) {
+    cerr << "cannot syncronize clock as times() returned -1" << endl;
+  }
 }
 
 void Lib::Timer::makeChildrenIncluded()
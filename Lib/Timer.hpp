@@ -25,6 +25,7 @@
 #ifndef __Timer__
 #define __Timer__
 
+#include <csignal>
 #include <iostream>
 
 #include "Debug/Assertion.hpp"
@@ -129,7 +130,29 @@ public:
 
   static void syncClock();
 
+  /**
+   * True if the time limit may have been reached. With UNIX_USE_SIGALRM
+   * the limit is tested by the timer signal handler on every tick, so this
+   * is a single load that hot loops can afford; otherwise it is always true
+   * and the caller has to test the limit itself.
+   */
+  static bool limitFlagged()
+  {
+#if UNIX_USE_SIGALRM
+    return s_limitFlag;
+#else
+    return true;
+#endif
+  }
+
   static bool s_timeLimitEnforcement;
+
+#if UNIX_USE_SIGALRM
+  static bool resyncClock();
+
+  /** set by the signal handler while the time limit is passed */
+  static volatile sig_atomic_t s_limitFlag;
+#endif
 private:
   /** true if the timer must account for the time spent in
    * children (otherwise it may or may not) */
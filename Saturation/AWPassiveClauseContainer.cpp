@@ -225,7 +225,7 @@ void AWPassiveClauseContainer::add(Clause* cl)
     _weightQueue.insert(cl);
   }
   _size++;
-  addedEvent.fire(cl);
+  fireAdded(cl);
 } // AWPassiveClauseContainer::add
 
 /**
@@ -247,7 +247,7 @@ void AWPassiveClauseContainer::remove(Clause* cl)
   }
   _size--;
 
-  removedEvent.fire(cl);
+  fireRemoved(cl);
 
   ASS(cl->store()!=Clause::PASSIVE);
 }
@@ -472,7 +472,7 @@ void AWClauseContainer::add(Clause* cl)
     _weightQueue.insert(cl);
   }
   _size++;
-  addedEvent.fire(cl);
+  fireAdded(cl);
 }
 
 /**
@@ -496,7 +496,7 @@ bool AWClauseContainer::remove(Clause* cl)
 
   if (removed) {
     _size--;
-    removedEvent.fire(cl);
+    fireRemoved(cl);
   }
   return removed;
 }
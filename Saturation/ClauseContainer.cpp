@@ -29,6 +29,7 @@
 #include "Kernel/Clause.hpp"
 #include "Shell/Statistics.hpp"
 
+#include "Indexing/Index.hpp"
 #include "Indexing/LiteralIndexingStructure.hpp"
 
 #include "SaturationAlgorithm.hpp"
@@ -46,6 +47,71 @@ namespace Saturation
 using namespace Kernel;
 using namespace Indexing;
 
+ClauseContainer::~ClauseContainer()
+{
+  // the indexes may outlive the container
+  Stack<Index*>::Iterator iit(_indexes);
+  while (iit.hasNext()) {
+    iit.next()->_container = 0;
+  }
+}
+
+/**
+ * Let the index @b idx be notified about clauses added to and removed
+ * from the container
+ */
+void ClauseContainer::attachIndex(Index* idx)
+{
+  CALL("ClauseContainer::attachIndex");
+  ASS(!_indexes.find(idx));
+
+  _indexes.push(idx);
+}
+
+void ClauseContainer::detachIndex(Index* idx)
+{
+  CALL("ClauseContainer::detachIndex");
+
+  // shift the later indexes down rather than filling the hole with the
+  // top one, so that the remaining ones are notified in the same order
+  Index** wr = _indexes.begin();
+  Index** end = _indexes.end();
+  while (*wr != idx) {
+    wr++;
+    ASS_L(wr, end);
+  }
+  for (Index** rd = wr+1; rd != end; rd++) {
+    *wr++ = *rd;
+  }
+  _indexes.pop();
+}
+
+/**
+ * Notify the attached indexes and the subscribers of @b addedEvent
+ * that the clause @b c was added to the container
+ */
+void ClauseContainer::fireAdded(Clause* c)
+{
+  Index** p = _indexes.end();
+  while (p != _indexes.begin()) {
+    (*--p)->handleClause(c, true);
+  }
+  addedEvent.fire(c);
+}
+
+/**
+ * Notify the attached indexes and the subscribers of @b removedEvent
+ * that the clause @b c was removed from the container
+ */
+void ClauseContainer::fireRemoved(Clause* c)
+{
+  Index** p = _indexes.end();
+  while (p != _indexes.begin()) {
+    (*--p)->handleClause(c, false);
+  }
+  removedEvent.fire(c);
+}
+
 void ClauseContainer::addClauses(ClauseIterator cit)
 {
   while (cit.hasNext()) {
@@ -112,7 +178,7 @@ void UnprocessedClauseContainer::add(Clause* c)
   CALL("UnprocessedClauseContainer::add");
 
   _data.push_back(c);
-  addedEvent.fire(c);
+  fireAdded(c);
 }
 
 Clause* UnprocessedClauseContainer::pop()
@@ -136,7 +202,7 @@ void ActiveClauseContainer::add(Clause* c)
 
   ASS(c->store()==Clause::ACTIVE);
   if(!c->in_active()){
-    addedEvent.fire(c);
+    fireAdded(c);
     c->toggle_in_active();
   }
   ASS(c->in_active());
@@ -154,7 +220,7 @@ void ActiveClauseContainer::remove(Clause* c)
   ASS(c->in_active());
 
   _size--;
-  removedEvent.fire(c);
+  fireRemoved(c);
 
   c->toggle_in_active();
   ASS(!c->in_active());
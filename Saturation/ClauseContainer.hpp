@@ -50,7 +50,7 @@ public:
   CLASS_NAME(ClauseContainer);
   USE_ALLOCATOR(ClauseContainer);
 
-  virtual ~ClauseContainer() {}
+  virtual ~ClauseContainer();
   ClauseEvent addedEvent;
   /**
    * This event fires when a clause is removed from the
@@ -69,6 +69,19 @@ public:
   ClauseEvent selectedEvent;
   virtual void add(Clause* c) = 0;
   void addClauses(ClauseIterator cit);
+
+  void attachIndex(Indexing::Index* idx);
+  void detachIndex(Indexing::Index* idx);
+protected:
+  void fireAdded(Clause* c);
+  void fireRemoved(Clause* c);
+private:
+  /**
+   * Indexes kept up to date with the content of the container. They are
+   * called directly from fireAdded() and fireRemoved(), most recently
+   * attached first, before the subscribers of addedEvent and removedEvent.
+   */
+  Stack<Indexing::Index*> _indexes;
 };
 
 class RandomAccessClauseContainer
@@ -102,7 +115,7 @@ public:
 
   virtual void add(Clause* c)
   {
-    addedEvent.fire(c);
+    fireAdded(c);
   }
 };
 
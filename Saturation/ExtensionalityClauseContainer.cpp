@@ -16,6 +16,8 @@
  * For other uses of Vampire please contact developers for a different
  * licence, which we will make an effort to provide. 
  */
+#include "Lib/Metaiterators.hpp"
+
 #include "Kernel/Clause.hpp"
 #include "Kernel/SortHelper.hpp"
 #include "Kernel/Term.hpp"
@@ -173,6 +175,73 @@ ExtensionalityClauseIterator ExtensionalityClauseContainer::activeIterator(unsig
                ActiveFilterFn(*this)));
 }
 
+ExtensionalityClauseContainer::~ExtensionalityClauseContainer()
+{
+  CALL("ExtensionalityClauseContainer::~ExtensionalityClauseContainer");
+
+  for (unsigned i = 0; i < _negEqualitiesBySort.size(); ++i) {
+    if (_negEqualitiesBySort[i]) {
+      delete _negEqualitiesBySort[i];
+    }
+  }
+}
+
+/**
+ * Record the selected negative equalities of a clause that has just been
+ * added to the active container.
+ */
+void ExtensionalityClauseContainer::onActiveAdded(Clause* c) {
+  CALL("ExtensionalityClauseContainer::onActiveAdded");
+
+  unsigned selCnt = c->numSelected();
+  for (unsigned i = 0; i < selCnt; ++i) {
+    Literal* l = (*c)[i];
+    if (!l->isEquality() || l->isPositive()) {
+      continue;
+    }
+    unsigned sort = SortHelper::getEqualityArgumentSort(l);
+    NegEqualitySet*& set = _negEqualitiesBySort[sort];
+    if (!set) {
+      set = new NegEqualitySet();
+    }
+    set->insert(make_pair(c, l));
+  }
+}
+
+void ExtensionalityClauseContainer::onActiveRemoved(Clause* c) {
+  CALL("ExtensionalityClauseContainer::onActiveRemoved");
+
+  unsigned selCnt = c->numSelected();
+  for (unsigned i = 0; i < selCnt; ++i) {
+    Literal* l = (*c)[i];
+    if (!l->isEquality() || l->isPositive()) {
+      continue;
+    }
+    unsigned sort = SortHelper::getEqualityArgumentSort(l);
+    NegEqualitySet* set = _negEqualitiesBySort[sort];
+    if (set) {
+      set->remove(make_pair(c, l));
+    }
+  }
+}
+
+/**
+ * Returns an iterator over pairs of an active clause and one of its selected
+ * negative equalities with arguments of @c sort.
+ *
+ * The pairs are copied, so the container may change while the iterator
+ * is being used.
+ */
+NegEqualityIterator ExtensionalityClauseContainer::activeNegEqualities(unsigned sort) {
+  CALL("ExtensionalityClauseContainer::activeNegEqualities");
+
+  NegEqualitySet* set = _negEqualitiesBySort[sort];
+  if (!set || set->size() == 0) {
+    return NegEqualityIterator::getEmpty();
+  }
+  return getPersistentIterator(NegEqualitySet::Iterator(*set));
+}
+
 void ExtensionalityClauseContainer::print (ostream& out) {
   CALL("ExtensionalityClauseContainer::print");
   
@@ -25,6 +25,7 @@
 
 #include "Shell/Options.hpp"
 
+#include "Lib/DHSet.hpp"
 #include "Lib/Environment.hpp"
 
 namespace Saturation
@@ -50,6 +51,7 @@ struct ExtensionalityClause
 
 typedef List<ExtensionalityClause> ExtensionalityClauseList;
 typedef VirtualIterator<ExtensionalityClause> ExtensionalityClauseIterator;
+typedef VirtualIterator<pair<Clause*, Literal*> > NegEqualityIterator;
 
 /**
  * Container for tracking extensionality-like clauses, i.e. clauses with exactly
@@ -70,10 +72,15 @@ public:
     _onlyTagged = (opt.extensionalityResolution() == Options::ExtensionalityResolution::TAGGED);
     _sortCnt = env.sorts->count();
     _clausesBySort.init(_sortCnt, 0);
+    _negEqualitiesBySort.init(_sortCnt, 0);
   }
+  ~ExtensionalityClauseContainer();
   Literal* addIfExtensionality(Clause* c);
   static Literal* getSingleVarEq(Clause* c);
   ExtensionalityClauseIterator activeIterator(unsigned sort);
+  NegEqualityIterator activeNegEqualities(unsigned sort);
+  void onActiveAdded(Clause* c);
+  void onActiveRemoved(Clause* c);
   unsigned size() const { return _size; }
   void print(ostream& o);
 private:
@@ -81,6 +88,14 @@ private:
   DArray<ExtensionalityClauseList*> _clausesBySort;
   void add(ExtensionalityClause c);
 
+  typedef DHSet<pair<Clause*, Literal*> > NegEqualitySet;
+  /**
+   * Selected negative equalities of active clauses, by the sort of their
+   * arguments. These are the only possible partners of extensionality
+   * clauses of that sort in backward extensionality resolution.
+   */
+  DArray<NegEqualitySet*> _negEqualitiesBySort;
+
   struct ActiveFilterFn;
 
   unsigned _size;
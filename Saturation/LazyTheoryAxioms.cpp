@@ -0,0 +1,168 @@
+
+/*
+ * File LazyTheoryAxioms.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+/**
+ * @file LazyTheoryAxioms.cpp
+ * Implements class LazyTheoryAxioms.
+ */
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Term.hpp"
+#include "Kernel/TermIterators.hpp"
+#include "Kernel/Theory.hpp"
+
+#include "LazyTheoryAxioms.hpp"
+
+namespace Saturation
+{
+
+LazyTheoryAxioms::~LazyTheoryAxioms()
+{
+  CALL("LazyTheoryAxioms::~LazyTheoryAxioms");
+
+  DHMap<unsigned,ClauseList*>::Iterator fit(_byFunction);
+  while(fit.hasNext()) {
+    ClauseList::destroy(fit.next());
+  }
+  DHMap<unsigned,ClauseList*>::Iterator pit(_byPredicate);
+  while(pit.hasNext()) {
+    ClauseList::destroy(pit.next());
+  }
+  // decRefCnt() keeps input clauses alive, but an axiom that never
+  // entered the search is not referenced from anywhere else
+  DHSet<Clause*>::Iterator cit(_pending);
+  while(cit.hasNext()) {
+    Clause* ax = cit.next();
+    ax->decRefCnt();
+    if(!ax->refCnt() && ax->store()==Clause::NONE) {
+      ax->destroy();
+    }
+  }
+}
+
+/**
+ * Push into @b funs and @b preds the interpreted non-constant function
+ * symbols and the interpreted predicate symbols other than equality
+ * that occur in @b cl. The stacks may contain duplicates.
+ */
+void LazyTheoryAxioms::collectSymbols(Clause* cl, Stack<unsigned>& funs, Stack<unsigned>& preds)
+{
+  CALL("LazyTheoryAxioms::collectSymbols");
+
+  unsigned clen = cl->length();
+  for(unsigned i=0; i<clen; i++) {
+    Literal* lit = (*cl)[i];
+    if(!lit->isEquality() && theory->isInterpretedPredicate(lit->functor())) {
+      preds.push(lit->functor());
+    }
+    NonVariableIterator nvi(lit);
+    while(nvi.hasNext()) {
+      Term* t = nvi.next().term();
+      if(!t->isSpecial() && theory->isInterpretedFunction(t->functor())) {
+        funs.push(t->functor());
+      }
+    }
+  }
+}
+
+/**
+ * Store theory axiom @b cl until a clause sharing an interpreted
+ * symbol with it is activated. Return false (and do not store the
+ * clause) if @b cl contains no interpreted symbol to wait for.
+ */
+bool LazyTheoryAxioms::add(Clause* cl)
+{
+  CALL("LazyTheoryAxioms::add");
+
+  static Stack<unsigned> funs;
+  static Stack<unsigned> preds;
+  funs.reset();
+  preds.reset();
+  collectSymbols(cl, funs, preds);
+  if(funs.isEmpty() && preds.isEmpty()) {
+    return false;
+  }
+
+  ALWAYS(_pending.insert(cl));
+  cl->incRefCnt();
+
+  ClauseList** pBucket;
+  Stack<unsigned>::Iterator fit(funs);
+  while(fit.hasNext()) {
+    _byFunction.getValuePtr(fit.next(), pBucket, 0);
+    if(ClauseList::isEmpty(*pBucket) || (*pBucket)->head()!=cl) {
+      ClauseList::push(cl, *pBucket);
+    }
+  }
+  Stack<unsigned>::Iterator pit(preds);
+  while(pit.hasNext()) {
+    _byPredicate.getValuePtr(pit.next(), pBucket, 0);
+    if(ClauseList::isEmpty(*pBucket) || (*pBucket)->head()!=cl) {
+      ClauseList::push(cl, *pBucket);
+    }
+  }
+  return true;
+}
+
+void LazyTheoryAxioms::releaseBucket(DHMap<unsigned,ClauseList*>& index, unsigned symbol, ClauseStack& acc)
+{
+  CALL("LazyTheoryAxioms::releaseBucket");
+
+  ClauseList* bucket;
+  if(!index.pop(symbol, bucket)) {
+    return;
+  }
+  while(bucket) {
+    Clause* ax = ClauseList::pop(bucket);
+    // an axiom with several interpreted symbols is released with the first of them
+    if(_pending.remove(ax)) {
+      acc.push(ax);
+    }
+  }
+}
+
+/**
+ * Release into @b acc the stored axioms that share an interpreted
+ * symbol with the activated clause @b cl.
+ *
+ * Released clauses still carry the reference taken in @c add(), which
+ * the caller has to drop once it has passed them on.
+ */
+void LazyTheoryAxioms::release(Clause* cl, ClauseStack& acc)
+{
+  CALL("LazyTheoryAxioms::release");
+
+  if(_pending.isEmpty()) {
+    return;
+  }
+
+  static Stack<unsigned> funs;
+  static Stack<unsigned> preds;
+  funs.reset();
+  preds.reset();
+  collectSymbols(cl, funs, preds);
+
+  while(funs.isNonEmpty()) {
+    releaseBucket(_byFunction, funs.pop(), acc);
+  }
+  while(preds.isNonEmpty()) {
+    releaseBucket(_byPredicate, preds.pop(), acc);
+  }
+}
+
+}
@@ -0,0 +1,78 @@
+
+/*
+ * File LazyTheoryAxioms.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+/**
+ * @file LazyTheoryAxioms.hpp
+ * Defines class LazyTheoryAxioms.
+ */
+
+#ifndef __LazyTheoryAxioms__
+#define __LazyTheoryAxioms__
+
+#include "Forwards.hpp"
+
+#include "Lib/DHMap.hpp"
+#include "Lib/DHSet.hpp"
+#include "Lib/List.hpp"
+#include "Lib/Stack.hpp"
+
+namespace Saturation
+{
+
+using namespace Lib;
+using namespace Kernel;
+
+/**
+ * Store of theory axiom clauses that are held back from proof search
+ * until they become relevant (--theory_axioms lazy).
+ *
+ * Each stored axiom is indexed by the interpreted (non-constant) function
+ * and predicate symbols occurring in it. When a clause is activated, all
+ * stored axioms sharing an interpreted symbol with it are released, so
+ * that axioms about operations the search never touches never enter it.
+ */
+class LazyTheoryAxioms
+{
+public:
+  CLASS_NAME(LazyTheoryAxioms);
+  USE_ALLOCATOR(LazyTheoryAxioms);
+
+  LazyTheoryAxioms() {}
+  ~LazyTheoryAxioms();
+
+  bool add(Clause* cl);
+  void release(Clause* cl, ClauseStack& acc);
+
+  /** Number of axioms that were not released yet */
+  unsigned size() const { return _pending.size(); }
+
+private:
+  static void collectSymbols(Clause* cl, Stack<unsigned>& funs, Stack<unsigned>& preds);
+  void releaseBucket(DHMap<unsigned,ClauseList*>& index, unsigned symbol, ClauseStack& acc);
+
+  /** Stored axioms by interpreted function symbols occurring in them */
+  DHMap<unsigned,ClauseList*> _byFunction;
+  /** Stored axioms by interpreted predicate symbols occurring in them */
+  DHMap<unsigned,ClauseList*> _byPredicate;
+  /** Axioms stored and not released yet */
+  DHSet<Clause*> _pending;
+};
+
+}
+
+#endif // __LazyTheoryAxioms__
@@ -77,7 +77,7 @@ protected:
      * makes it from unprocessed to passive container.
      */
     void add(Clause* c)
-    { addedEvent.fire(c); }
+    { fireAdded(c); }
 
     /**
      * This method is subscribed to remove events of passive
@@ -86,7 +86,7 @@ protected:
      * selection in passive container doesn't count as removal.)
      */
     void remove(Clause* c)
-    { removedEvent.fire(c); }
+    { fireRemoved(c); }
   };
 
   FakeContainer _simplCont;
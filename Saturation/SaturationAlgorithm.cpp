@@ -122,12 +122,25 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
     _theoryInstSimp(0),
 #endif
     _generatedClauseCount(0),
-    _activationLimit(0)
+    _activationLimit(0),
+    _activationBatch(1),
+    _snapshotInterval(0),
+    _snapshotActivations(0),
+    _lastSnapshotTime(0)
 {
   CALL("SaturationAlgorithm::SaturationAlgorithm");
   ASS_EQ(s_instance, 0);  //there can be only one saturation algorithm at a time
 
   _activationLimit = opt.activationLimit();
+  _activationBatch = opt.activationBatch();
+  _snapshotInterval = opt.statisticsSnapshotInterval();
+  _snapshotActivations = opt.statisticsSnapshotActivations();
+  if ((_snapshotInterval || _snapshotActivations) && !opt.statisticsSnapshotFile().empty()) {
+    _snapshotFile.open(opt.statisticsSnapshotFile().c_str());
+    if (!_snapshotFile.is_open()) {
+      USER_ERROR("Cannot open statistics snapshot file "+opt.statisticsSnapshotFile());
+    }
+  }
 
   _ordering = OrderingSP(Ordering::create(prb, opt));
   if (!Ordering::trySetGlobalOrdering(_ordering)) {
@@ -157,9 +170,17 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   if (opt.extensionalityResolution() != Options::ExtensionalityResolution::OFF) {
     _extensionality = new ExtensionalityClauseContainer(opt);
     //_active->addedEvent.subscribe(_extensionality, &ExtensionalityClauseContainer::addIfExtensionality);
+    _active->addedEvent.subscribe(_extensionality, &ExtensionalityClauseContainer::onActiveAdded);
+    _active->removedEvent.subscribe(_extensionality, &ExtensionalityClauseContainer::onActiveRemoved);
   } else {
     _extensionality = 0;
   }
+
+  if (opt.theoryAxioms() == Options::TheoryAxiomLevel::LAZY) {
+    _lazyTheoryAxioms = new LazyTheoryAxioms();
+  } else {
+    _lazyTheoryAxioms = 0;
+  }
   
   if (opt.maxWeight()) {
     _limits.setLimits(0,opt.maxWeight());
@@ -209,6 +230,10 @@ SaturationAlgorithm::~SaturationAlgorithm()
     delete bse;
   }
 
+  if (_lazyTheoryAxioms) {
+    delete _lazyTheoryAxioms;
+  }
+
   delete _unprocessed;
   delete _active;
   delete _passive;
@@ -273,6 +298,19 @@ void SaturationAlgorithm::onActiveAdded(Clause* c)
     env.out() << "[SA] active: " << c->toString() << std::endl;
     env.endOutput();             
   }          
+
+  // every activation passes through here, given clauses as well as
+  // set-of-support ones
+  if (_lazyTheoryAxioms) {
+    static ClauseStack released;
+    released.reset();
+    _lazyTheoryAxioms->release(c, released);
+    while (released.isNonEmpty()) {
+      Clause* ax = released.pop();
+      addNewClause(ax);
+      ax->decRefCnt();
+    }
+  }
 }
 
 /**
@@ -563,6 +601,8 @@ void SaturationAlgorithm::addInputClause(Clause* cl)
 
   if (sosForAxioms || (isTheory && sosForTheory)){
     addInputSOSClause(cl);
+  } else if (isTheory && _lazyTheoryAxioms && _lazyTheoryAxioms->add(cl)) {
+    // the clause enters the search when a clause with one of its interpreted symbols is activated
   } else {
     addNewClause(cl);
   }
@@ -1151,6 +1191,10 @@ UnitList* SaturationAlgorithm::collectSaturatedSet()
 }
 
 /**
+ * Process the unprocessed clauses and activate the next given clause,
+ * or the next @b _activationBatch of them. The activation limit counts
+ * these steps, so with batches it bounds the number of batches rather
+ * than of given clauses.
  *
  * This function may throw RefutationFoundException and TimeLimitExceededException.
  */
@@ -1179,9 +1223,42 @@ void SaturationAlgorithm::doOneAlgorithmStep()
     throw MainLoopFinishedException(res);
   }
 
-  Clause* cl = _passive->popSelected();
-  ASS_EQ(cl->store(),Clause::PASSIVE);
-  cl->setStore(Clause::SELECTED);
+  if (_activationBatch==1) {
+    Clause* cl = _passive->popSelected();
+    ASS_EQ(cl->store(),Clause::PASSIVE);
+    cl->setStore(Clause::SELECTED);
+
+    activateSelected(cl);
+    return;
+  }
+
+  // Select a whole batch of given clauses first and only then activate
+  // them. Clauses generated by the batch are processed together in the
+  // next step, so the given clauses of a batch are chosen independently
+  // of each other.
+  static Stack<Clause*> batch;
+  batch.reset();
+  while (batch.size()<_activationBatch && !_passive->isEmpty()) {
+    Clause* cl = _passive->popSelected();
+    ASS_EQ(cl->store(),Clause::PASSIVE);
+    cl->setStore(Clause::SELECTED);
+    batch.push(cl);
+  }
+
+  Stack<Clause*>::BottomFirstIterator bit(batch);
+  while (bit.hasNext()) {
+    activateSelected(bit.next());
+  }
+  batch.reset();
+}
+
+/**
+ * Activate a clause popped from the passive container
+ */
+void SaturationAlgorithm::activateSelected(Clause* cl)
+{
+  CALL("SaturationAlgorithm::activateSelected");
+  ASS_EQ(cl->store(),Clause::SELECTED);
 
   if (!handleClauseBeforeActivation(cl)) {
     return;
@@ -1212,10 +1289,13 @@ MainLoopResult SaturationAlgorithm::runImpl()
 
       doOneAlgorithmStep();
 
-      Timer::syncClock();
       if (env.timeLimitReached()) {
         throw TimeLimitExceededException();
       }
+
+      if (_snapshotInterval || _snapshotActivations) {
+        considerStatisticsSnapshot(l);
+      }
     }
   }
   catch(ThrowableBase&)
@@ -1226,6 +1306,32 @@ MainLoopResult SaturationAlgorithm::runImpl()
 
 }
 
+/**
+ * Write a statistics snapshot if @b step (the number of the main loop
+ * iteration just finished) or the time since the last snapshot
+ * requires it.
+ */
+void SaturationAlgorithm::considerStatisticsSnapshot(unsigned step)
+{
+  CALL("SaturationAlgorithm::considerStatisticsSnapshot");
+
+  int now = env.timer->elapsedMilliseconds();
+  if (!(_snapshotActivations && (step+1)%_snapshotActivations==0) &&
+      !(_snapshotInterval && now-_lastSnapshotTime >= static_cast<int>(_snapshotInterval))) {
+    return;
+  }
+  _lastSnapshotTime = now;
+
+  if (_snapshotFile.is_open()) {
+    env.statistics->printSnapshot(_snapshotFile);
+  }
+  else {
+    env.beginOutput();
+    env.statistics->printSnapshot(env.out());
+    env.endOutput();
+  }
+}
+
 #if VZ3
 void SaturationAlgorithm::setTheoryInstAndSimp(TheoryInstAndSimp* t)
 {
@@ -25,6 +25,8 @@
 #ifndef __SaturationAlgorithm__
 #define __SaturationAlgorithm__
 
+#include <fstream>
+
 #include "Forwards.hpp"
 
 #include "Lib/DHMap.hpp"
@@ -43,6 +45,7 @@
 #include "Inferences/TheoryInstAndSimp.hpp"
 
 #include "Saturation/ExtensionalityClauseContainer.hpp"
+#include "Saturation/LazyTheoryAxioms.hpp"
 
 #include "Limits.hpp"
 
@@ -147,6 +150,7 @@ protected:
   void backwardSimplify(Clause* c);
   void addToPassive(Clause* c);
   bool activate(Clause* c);
+  void activateSelected(Clause* c);
   virtual void onSOSClauseAdded(Clause* c) {}
   void onActiveAdded(Clause* c);
   virtual void onActiveRemoved(Clause* c);
@@ -193,6 +197,8 @@ protected:
   PassiveClauseContainer* _passive;
   ActiveClauseContainer* _active;
   ExtensionalityClauseContainer* _extensionality;
+  /** Theory axioms held back until relevant, non-zero iff --theory_axioms lazy */
+  LazyTheoryAxioms* _lazyTheoryAxioms;
 
   ScopedPtr<GeneratingInferenceEngine> _generator;
   ScopedPtr<ImmediateSimplificationEngine> _immediateSimplifier;
@@ -235,7 +241,21 @@ protected:
   /** Number of clauses that entered the unprocessed container */
   unsigned _generatedClauseCount;
 
+  /** Maximal number of algorithm steps, i.e. of batches of given clauses (0 for no limit) */
   unsigned _activationLimit;
+  /** Number of given clauses selected together in one algorithm step */
+  unsigned _activationBatch;
+
+  void considerStatisticsSnapshot(unsigned step);
+
+  /** Milliseconds between statistics snapshots, 0 if not time-based */
+  unsigned _snapshotInterval;
+  /** Main loop iterations between statistics snapshots, 0 if not iteration-based */
+  unsigned _snapshotActivations;
+  /** Time of the last statistics snapshot */
+  int _lastSnapshotTime;
+  /** File for the statistics snapshots; if not open, they go to env.out() */
+  ofstream _snapshotFile;
 };
 
 
@@ -661,7 +661,7 @@ vstring Splitter::splPrefix = "";
 
 Splitter::Splitter()
 : _deleteDeactivated(Options::SplittingDeleteDeactivated::ON), _branchSelector(*this),
-  _clausesAdded(false), _haveBranchRefutation(false)
+  _modelGeneration(0), _clausesAdded(false), _haveBranchRefutation(false)
 {
   CALL("Splitter::Splitter");
   if(env.options->proof()==Options::Proof::TPTP){
@@ -1470,15 +1470,28 @@ bool Splitter::allSplitLevelsActive(SplitSet* s)
 {
   CALL("Splitter::allSplitLevelsActive");
 
+  if(s->isEmpty()) {
+    return true;
+  }
+
+  unsigned* gen;
+  if(!_activeInGeneration.getValuePtr(s,gen) && *gen==_modelGeneration) {
+    // no component has been deactivated since the last positive check
+    return true;
+  }
+
   SplitSet::Iterator sit(*s);
   while(sit.hasNext()) {
     SplitLevel lev=sit.next();
     ASS_REP(lev<_db.size(), lev);
     ASS_REP(_db[lev]!=0, lev);
     if (!_db[lev]->active) {
+      // never equal to _modelGeneration, which only grows
+      *gen = _modelGeneration-1;
       return false;
     }
   }
+  *gen = _modelGeneration;
   return true;
 }
 
@@ -1745,6 +1758,7 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
 
     ASS(sr->active);
     sr->active = false;
+    _modelGeneration++;
   }
 }
 
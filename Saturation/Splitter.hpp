@@ -280,6 +280,15 @@ private:
   Stack<SplitRecord*> _db;
   DHMap<Clause*,SplitLevel> _compNames;
 
+  /**
+   * Incremented whenever a component is deactivated. A split set
+   * that was found all-active in the current generation stays so
+   * until the next deactivation, as activation never invalidates it.
+   */
+  unsigned _modelGeneration;
+  /** Generation in which a split set was last found all-active */
+  DHMap<SplitSet*,unsigned> _activeInGeneration;
+
   DHMap<SplitLevel,Unit*> _defs;
   
   //state variable used for flushing:  
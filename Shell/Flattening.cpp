@@ -39,6 +39,17 @@
 namespace Shell
 {
 
+unsigned Flattening::s_depth = 0;
+DHMap<Formula*,Formula*> Flattening::s_cache;
+
+Flattening::MemoScope::MemoScope()
+{
+  // formulas from the previous call may have been destroyed since
+  if (!s_depth++) {
+    s_cache.reset();
+  }
+}
+
 /**
  * Assuming formula @c f is flatenned, return its negation which is also flatenned.
  */
@@ -106,6 +117,33 @@ Formula* Flattening::flatten (Formula* f)
 {
   CALL("Flattening::flatten(Formula*)");
 
+  switch (f->connective()) {
+  case LITERAL:
+  case TRUE:
+  case FALSE:
+    return flattenStep(f);
+  default:
+    break;
+  }
+
+  MemoScope scope;
+  Formula* res;
+  if (s_cache.find(f, res)) {
+    return res;
+  }
+  res = flattenStep(f);
+  s_cache.insert(f, res);
+  return res;
+} // Flattening::flatten(Formula*)
+
+/**
+ * Flatten a formula without consulting the cache of already flattened
+ * subformulas.
+ */
+Formula* Flattening::flattenStep (Formula* f)
+{
+  CALL("Flattening::flattenStep");
+
   Connective con = f->connective();
   switch (con) {
   case TRUE:
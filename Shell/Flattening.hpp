@@ -27,6 +27,8 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
+
 #include "Kernel/Formula.hpp"
 
 namespace Shell {
@@ -48,6 +50,23 @@ public:
 
   static Formula* getFlattennedNegation(Formula* f);
 private:
+  static Formula* flattenStep(Formula*);
+
+  /** open while flatten(Formula*) is running on a compound formula */
+  struct MemoScope
+  {
+    MemoScope();
+    ~MemoScope() { s_depth--; }
+  };
+
+  /** nesting depth of flatten(Formula*) */
+  static unsigned s_depth;
+  /**
+   * Results of flattening compound subformulas during the outermost
+   * call of flatten(Formula*), so that shared subformulas are flattened
+   * once and remain shared
+   */
+  static Lib::DHMap<Formula*,Formula*> s_cache;
 }; // class Flattening
 
 }
@@ -345,6 +345,33 @@ Unit* Interpolants::formulifyRefutation(Unit* refutation)
   return translate.get(refutation);
 }
 
+/**
+ * For each unit of the refutation, count how many times it occurs
+ * among the parents of units of the refutation
+ *
+ * This is the number of times getInterpolant() passes the interpolants
+ * of the unit to a conclusion.
+ */
+void Interpolants::countUses(Unit* refutation, DHMap<Unit*,unsigned>& useCnt)
+{
+  CALL("Interpolants::countUses");
+
+  Stack<Unit*> toDo;
+  useCnt.insert(refutation, 0);
+  toDo.push(refutation);
+  while(toDo.isNonEmpty()) {
+    UnitIterator pit = getParents(toDo.pop());
+    while(pit.hasNext()) {
+      Unit* par = pit.next();
+      unsigned* pCnt;
+      if(useCnt.getValuePtr(par, pCnt, 0)) {
+	toDo.push(par);
+      }
+      (*pCnt)++;
+    }
+  }
+}
+
 Formula* Interpolants::getInterpolant(Unit* unit)
 {
   CALL("Interpolants::getInterpolant");
@@ -352,6 +379,12 @@ Formula* Interpolants::getInterpolant(Unit* unit)
   typedef DHMap<Unit*,ItemState> ProcMap;
   ProcMap processed;
 
+  //the interpolant lists of a unit are released once they were passed to
+  //all its conclusions, so that only the lists of units whose conclusions
+  //are still being traversed are kept in memory
+  DHMap<Unit*,unsigned> useCnt;
+  countUses(unit, useCnt);
+
   TRACE(cout << "===== getInterpolant for " << unit->toString() << endl);
 
   Stack<ItemState> sts;
@@ -469,6 +502,15 @@ Formula* Interpolants::getInterpolant(Unit* unit)
         if(color!=COLOR_RIGHT) {
           mergeCopy(sts.top().rightInts, st.rightInts);
         }
+        unsigned& uses = useCnt.get(st.us());
+        ASS_G(uses, 0);
+        uses--;
+        if(!uses) {
+          ItemState& pst = processed.get(st.us());
+          pst.destroy();
+          pst.leftInts = 0;
+          pst.rightInts = 0;
+        }
       } 
       else {
 	//empty sts (so refutation) with clause st justified by A or B (st is false). 
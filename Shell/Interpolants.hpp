@@ -54,6 +54,7 @@ private:
   void generateInterpolant(ItemState& st);
 
   UnitIterator getParents(Unit* u);
+  void countUses(Unit* refutation, DHMap<Unit*,unsigned>& useCnt);
 
   DHSet<Unit*>* _slicedOff;
 
@@ -35,6 +35,20 @@
 using namespace Kernel;
 using namespace Shell;
 
+unsigned NNF::s_depth = 0;
+DHMap<Formula*,Formula*> NNF::s_ennfCache[2];
+DHMap<Formula*,Formula*> NNF::s_nnfCache[2];
+
+NNF::MemoScope::MemoScope()
+{
+  if (!s_depth++) {
+    s_ennfCache[0].reset();
+    s_ennfCache[1].reset();
+    s_nnfCache[0].reset();
+    s_nnfCache[1].reset();
+  }
+}
+
 /**
  * Transform the unit into ENNF.
  * @since 28/12/2003 Manchester
@@ -109,6 +123,34 @@ Formula* NNF::ennf (Formula* f, bool polarity)
 {
   CALL("NNF::ennf(Formula*...)");
 
+  MemoScope scope;
+  switch (f->connective()) {
+  case LITERAL:
+  case TRUE:
+  case FALSE:
+    return ennfStep(f, polarity);
+  default:
+    break;
+  }
+
+  // a shared subformula is transformed once, and the result stays shared
+  Formula* res;
+  if (s_ennfCache[polarity].find(f, res)) {
+    return res;
+  }
+  res = ennfStep(f, polarity);
+  s_ennfCache[polarity].insert(f, res);
+  return res;
+} // NNF::ennf(Formula*)
+
+/**
+ * Transform a formula into ENNF without consulting the cache of
+ * already transformed subformulas.
+ */
+Formula* NNF::ennfStep (Formula* f, bool polarity)
+{
+  CALL("NNF::ennfStep");
+
   Connective c = f->connective();
   switch (c) {
   case LITERAL:
@@ -431,6 +473,35 @@ Formula* NNF::nnf (Formula* f, bool polarity)
 {
   CALL("NNF::nnf(Formula*...)");
 
+  MemoScope scope;
+  switch (f->connective()) {
+  case LITERAL:
+  case TRUE:
+  case FALSE:
+    return nnfStep(f, polarity);
+  default:
+    break;
+  }
+
+  // both sides of an equivalence are needed in both polarities, without
+  // the cache nested equivalences would be expanded exponentially
+  Formula* res;
+  if (s_nnfCache[polarity].find(f, res)) {
+    return res;
+  }
+  res = nnfStep(f, polarity);
+  s_nnfCache[polarity].insert(f, res);
+  return res;
+} // NNF::nnf(Formula*)
+
+/**
+ * Transform a formula into NNF without consulting the cache of
+ * already transformed subformulas.
+ */
+Formula* NNF::nnfStep (Formula* f, bool polarity)
+{
+  CALL("NNF::nnfStep");
+
   Connective c = f->connective();
   switch (c) {
   case LITERAL:
@@ -30,6 +30,8 @@ namespace Kernel {
   class Unit;
 };
 
+#include "Lib/DHMap.hpp"
+
 #include "Kernel/Formula.hpp"
 
 using namespace Kernel;
@@ -51,6 +53,26 @@ private:
   static FormulaList* ennf(FormulaList*, bool polarity);
   static Formula* nnf(Formula*, bool polarity);
   static FormulaList* nnf(FormulaList*, bool polarity);
+  static Formula* ennfStep(Formula*, bool polarity);
+  static Formula* nnfStep(Formula*, bool polarity);
+
+  /**
+   * Open while a formula-level transformation is running. The caches
+   * are emptied when the outermost scope is entered, since the formulas
+   * they refer to may have been destroyed since the previous call.
+   */
+  struct MemoScope
+  {
+    MemoScope();
+    ~MemoScope() { s_depth--; }
+  };
+
+  /** nesting depth of formula-level transformations */
+  static unsigned s_depth;
+  /** results of ennf of compound subformulas, indexed by polarity */
+  static Lib::DHMap<Formula*,Formula*> s_ennfCache[2];
+  /** results of nnf of compound subformulas, indexed by polarity */
+  static Lib::DHMap<Formula*,Formula*> s_nnfCache[2];
 }; // class NNF
 
 }
@@ -22,6 +22,9 @@
  * @since 25/12/2003 Manchester
  */
 
+#include <climits>
+
+#include "Lib/DArray.hpp"
 #include "Lib/Sort.hpp"
 #include "Lib/Environment.hpp"
 
@@ -72,18 +75,23 @@ UnitList* Normalisation::normalise (UnitList* units)
 
   unsigned length = UnitList::length(units);
 
-  // more than one literal
-  Sort<Unit*,Normalisation> srt(length,*this);
+  // keys are computed once per unit, so that the sort itself mostly
+  // compares a few integers instead of whole units
+  DArray<UnitKey> keys(length);
+  Sort<UnitKey*,Normalisation> srt(length,*this);
   UnitList::Iterator us(units);
+  unsigned idx = 0;
   while (us.hasNext()) {
     Unit* unit = us.next();
     normalise(unit);
-    srt.add(unit);
+    computeKey(unit,keys[idx]);
+    srt.add(&keys[idx]);
+    idx++;
   }
   srt.sort();
   UnitList* result = UnitList::empty();
   for (int k = length-1;k >= 0;k--) {
-    result = new UnitList(srt[k],result);
+    result = new UnitList(srt[k]->unit,result);
   }
   UnitList::destroy(units);
   return result;
@@ -125,6 +133,85 @@ void Normalisation::normalise (Unit* unit)
 } // Normalisation::normalise(Unit*)
 
 
+/**
+ * Compute the key of a normalised unit.
+ *
+ * Each component of the key is a quantity that lessThan(Unit*,Unit*)
+ * compares in the same order before it looks at anything else, so that
+ * units with different keys compare in the same way as their keys.
+ */
+void Normalisation::computeKey(Unit* unit, UnitKey& res)
+{
+  CALL("Normalisation::computeKey(Unit*...)");
+
+  res.unit = unit;
+  unsigned* key = res.key;
+  for (unsigned i = 0;i < UNIT_KEY_LEN;i++) {
+    key[i] = 0;
+  }
+
+  // units with greater input type come first
+  key[0] = ~(unsigned)unit->inputType();
+  if (unit->isClause()) {
+    Clause* cl = static_cast<Clause*>(unit);
+    key[1] = 0;
+    key[2] = cl->length();
+    if (cl->length()) {
+      computeKey((*cl)[0],key+3);
+    }
+    return;
+  }
+
+  Formula* f = static_cast<FormulaUnit*>(unit)->formula();
+  key[1] = 1;
+  key[2] = f->connective();
+  switch (f->connective()) {
+  case LITERAL:
+    computeKey(f->literal(),key+3);
+    break;
+  case FORALL:
+  case EXISTS:
+    key[3] = Formula::VarList::length(f->vars());
+    break;
+  default:
+    break;
+  }
+} // Normalisation::computeKey(Unit*...)
+
+/**
+ * Write four key components of a literal into @b key, following the
+ * order of tests in compare(Literal*,Literal*).
+ */
+void Normalisation::computeKey(Literal* lit, unsigned* key)
+{
+  CALL("Normalisation::computeKey(Literal*...)");
+
+  // shared literals are less than non-shared ones and are
+  // compared by weight first
+  key[0] = lit->shared() ? lit->weight() : UINT_MAX;
+  key[1] = lit->isPositive() ? 1 : 0;
+  key[2] = lit->isEquality() ? 0 : 1;
+  // literals with the same predicate have the same arity, and arity is
+  // the first thing compared for different predicates
+  key[3] = lit->arity();
+} // Normalisation::computeKey(Literal*...)
+
+/**
+ * Comparison operator for precomputed unit keys, required for using
+ * class Sort. Falls back to lessThan(Unit*,Unit*) when the keys are equal.
+ */
+bool Normalisation::lessThan (UnitKey* k1, UnitKey* k2)
+{
+  CALL("Normalisation::lessThan (UnitKey*...)");
+
+  for (unsigned i = 0;i < UNIT_KEY_LEN;i++) {
+    if (k1->key[i] != k2->key[i]) {
+      return k1->key[i] < k2->key[i];
+    }
+  }
+  return lessThan(k1->unit,k2->unit);
+} // Normalisation::lessThan (UnitKey*...)
+
 /**
  * Comparison operator, required for using class Sort.
  *
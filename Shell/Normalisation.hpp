@@ -49,8 +49,24 @@ public:
   UnitList* normalise(UnitList*);
   bool lessThan(Literal*, Literal*);
   bool lessThan(Unit*, Unit*);
+
+  /** Number of components of a precomputed unit key */
+  static const unsigned UNIT_KEY_LEN = 7;
+
+  /**
+   * A unit together with a prefix of its position in the unit ordering.
+   * Keys are computed once per unit and compared lexicographically;
+   * the structural comparison of units is only needed when keys coincide.
+   */
+  struct UnitKey {
+    Unit* unit;
+    unsigned key[UNIT_KEY_LEN];
+  };
+  bool lessThan(UnitKey*, UnitKey*);
 private:
   void normalise(Unit*);
+  void computeKey(Unit*, UnitKey&);
+  void computeKey(Literal*, unsigned* key);
   Comparison compare(Term*, Term*);
   Comparison compare(Formula*, Formula*);
   Comparison compare(Literal*, Literal*);
@@ -112,6 +112,7 @@ void Options::Options::init()
                                         "casc_ltb",
                                         "clausify",
                                         "consequence_elimination",
+                                        "daemon",
                                         "grounding",
                                         "model_check",
                                         "output",
@@ -134,6 +135,7 @@ void Options::Options::init()
     "  -tpreprocess,tclausify: output modes for theory input"
     "  -output,profile: output information about the problem\n"
     "  -sat_solver: accepts problems in DIMACS and uses the internal sat solver\n   directly\n"
+    "  -daemon: reads problem file names (optionally followed by an option string)\n   from the standard input and solves each in a forked child\n"
     "Some modes are not currently maintained:\n"
     "  -bpa: perform bound propagation\n"
     "  -consequence_elimination: perform consequence elimination\n"
@@ -338,6 +340,24 @@ void Options::Options::init()
     _lookup.insert(&_timeStatistics);
     _timeStatistics.tag(OptionTag::OUTPUT);
 
+    _statisticsSnapshotInterval = UnsignedOptionValue("statistics_snapshot_interval","ssi",0);
+    _statisticsSnapshotInterval.description="During saturation, write a snapshot of the statistics as a line of JSON every this many milliseconds. 0 means no time-based snapshots.";
+    _lookup.insert(&_statisticsSnapshotInterval);
+    _statisticsSnapshotInterval.tag(OptionTag::OUTPUT);
+    _statisticsSnapshotInterval.setExperimental();
+
+    _statisticsSnapshotActivations = UnsignedOptionValue("statistics_snapshot_activations","ssa",0);
+    _statisticsSnapshotActivations.description="During saturation, write a snapshot of the statistics as a line of JSON every this many iterations of the main loop. 0 means no iteration-based snapshots.";
+    _lookup.insert(&_statisticsSnapshotActivations);
+    _statisticsSnapshotActivations.tag(OptionTag::OUTPUT);
+    _statisticsSnapshotActivations.setExperimental();
+
+    _statisticsSnapshotFile = StringOptionValue("statistics_snapshot_file","","");
+    _statisticsSnapshotFile.description="File to which the statistics snapshots are written. If empty, they are written to the standard output.";
+    _lookup.insert(&_statisticsSnapshotFile);
+    _statisticsSnapshotFile.tag(OptionTag::OUTPUT);
+    _statisticsSnapshotFile.setExperimental();
+
 //*********************** Input  ***********************
 
     _include = StringOptionValue("include","","");
@@ -489,8 +509,9 @@ void Options::Options::init()
     _blockedClauseElimination.addProblemConstraint(notWithCat(Property::UEQ));
     _blockedClauseElimination.setRandomChoices({"on","off"});
 
-    _theoryAxioms = ChoiceOptionValue<TheoryAxiomLevel>("theory_axioms","tha",TheoryAxiomLevel::ON,{"on","off","some"});
-    _theoryAxioms.description="Include theory axioms for detected interpreted symbols";
+    _theoryAxioms = ChoiceOptionValue<TheoryAxiomLevel>("theory_axioms","tha",TheoryAxiomLevel::ON,{"on","off","some","lazy"});
+    _theoryAxioms.description="Include theory axioms for detected interpreted symbols. With lazy, theory axiom clauses"
+      " are kept aside and enter the search only once a clause containing one of their interpreted symbols is activated";
     _lookup.insert(&_theoryAxioms);
     _theoryAxioms.tag(OptionTag::PREPROCESSING);
 
@@ -947,6 +968,14 @@ void Options::Options::init()
 	    _instantiation.setRandomChoices({"off","on"}); // Turn this on rarely
 	    _instantiation.setExperimental();
 
+	    _instantiationCandidateLimit = UnsignedOptionValue("instantiation_candidate_limit","instcl",0);
+	    _instantiationCandidateLimit.description = "Maximal number of candidate terms per sort kept for instantiation."
+	      " The most frequent and most recently seen terms are preferred. If zero there is no maximum.";
+	    _instantiationCandidateLimit.tag(OptionTag::INFERENCES);
+	    _lookup.insert(&_instantiationCandidateLimit);
+	    _instantiationCandidateLimit.reliesOn(_instantiation.is(notEqual(Instantiation::OFF)));
+	    _instantiationCandidateLimit.setExperimental();
+
 	    _backwardDemodulation = ChoiceOptionValue<Demodulation>("backward_demodulation","bd",
 								    Demodulation::ALL,
 								    {"all","off","preordered"});
@@ -1134,6 +1163,20 @@ void Options::Options::init()
     _lookup.insert(&_hyperSuperposition);
     _hyperSuperposition.tag(OptionTag::INFERENCES);
 
+    _hyperSuperpositionRewriterLimit = UnsignedOptionValue("hyper_superposition_rewriter_limit","hsrl",0);
+    _hyperSuperpositionRewriterLimit.description=
+    "Maximal number of unit equalities hyper superposition uses to make two terms unifiable. If zero there is no maximum.";
+    _lookup.insert(&_hyperSuperpositionRewriterLimit);
+    _hyperSuperpositionRewriterLimit.tag(OptionTag::INFERENCES);
+    _hyperSuperpositionRewriterLimit.reliesOn(_hyperSuperposition.is(equal(true)));
+
+    _hyperSuperpositionCandidateLimit = UnsignedOptionValue("hyper_superposition_candidate_limit","hscl",0);
+    _hyperSuperpositionCandidateLimit.description=
+    "Maximal number of unit clauses hyper superposition tries to resolve a clause with. If zero there is no maximum.";
+    _lookup.insert(&_hyperSuperpositionCandidateLimit);
+    _hyperSuperpositionCandidateLimit.tag(OptionTag::INFERENCES);
+    _hyperSuperpositionCandidateLimit.reliesOn(_hyperSuperposition.is(equal(true)));
+
     _innerRewriting = BoolOptionValue("inner_rewriting","irw",false);
     _innerRewriting.description="C[t_1] | t1 != t2 ==> C[t_2] | t1 != t2 when t1>t2";
     _lookup.insert(&_innerRewriting);
@@ -1162,6 +1205,13 @@ void Options::Options::init()
     _unitResultingResolution.setRandomChoices(isRandSat(),{});
     _unitResultingResolution.setRandomChoices({"on","on","off"});
 
+    _unitResultingResolutionLimit = UnsignedOptionValue("unit_resulting_resolution_limit","urrl",0);
+    _unitResultingResolutionLimit.description=
+    "Maximal number of clauses unit resulting resolution derives from one given clause. If zero there is no maximum.";
+    _lookup.insert(&_unitResultingResolutionLimit);
+    _unitResultingResolutionLimit.tag(OptionTag::INFERENCES);
+    _unitResultingResolutionLimit.reliesOn(_unitResultingResolution.is(notEqual(URResolution::OFF)));
+
 
     _superpositionFromVariables = BoolOptionValue("superposition_from_variables","sfv",true);
     _superpositionFromVariables.description="Perform superposition from variables.";
@@ -1663,10 +1713,18 @@ void Options::Options::init()
     _randomSeed.tag(OptionTag::INPUT);
 
     _activationLimit = IntOptionValue("activation_limit","al",0);
-    _activationLimit.description="Terminate saturation after this many iterations of the main loop. 0 means no limit.";
+    _activationLimit.description="Terminate saturation after this many iterations of the main loop. 0 means no limit."
+      " With activation_batch above 1 an iteration activates a whole batch, so the limit counts batches rather than given clauses.";
     _activationLimit.setExperimental();
     _lookup.insert(&_activationLimit);
 
+    _activationBatch = UnsignedOptionValue("activation_batch","ab",1);
+    _activationBatch.description="Number of given clauses selected from the passive container in one iteration of the main loop. All of them are activated before the clauses they generated are processed."
+      " The activation_limit then counts batches rather than given clauses.";
+    _activationBatch.addHardConstraint(greaterThan(0u));
+    _activationBatch.setExperimental();
+    _lookup.insert(&_activationBatch);
+
     _termOrdering = ChoiceOptionValue<TermOrdering>("term_ordering","to", TermOrdering::KBO,
                                                     {"kbo","lpo"});
     _termOrdering.description="The term ordering used by Vampire to orient equations and order literals";
@@ -263,7 +263,8 @@ public:
   enum class TheoryAxiomLevel : unsigned int {
     ON,  // all of them
     OFF, // none of them
-    CHEAP 
+    CHEAP,
+    LAZY // all of them, but clauses are added to the search only when relevant
   };
 
   enum class ProofExtra : unsigned int {
@@ -407,6 +408,8 @@ public:
     CASC_LTB,
     CLAUSIFY,
     CONSEQUENCE_ELIMINATION,
+    /** solve problems given on the standard input, each in a forked child */
+    DAEMON,
     GROUNDING,
     MODEL_CHECK,
     /** this mode only outputs the input problem, without any preprocessing */
@@ -1837,6 +1840,7 @@ public:
   LTBLearning ltbLearning() const { return _ltbLearning.actualValue; }
   vstring ltbDirectory() const { return _ltbDirectory.actualValue; }
   Mode mode() const { return _mode.actualValue; }
+  void setMode(Mode newVal) { _mode.actualValue = newVal; }
   Schedule schedule() const { return _schedule.actualValue; }
   vstring scheduleName() const { return _schedule.getStringOfValue(_schedule.actualValue); }
   void setSchedule(Schedule newVal) {  _schedule.actualValue = newVal; }
@@ -1855,6 +1859,7 @@ public:
   vstring logFile() const { return _logFile.actualValue; }
   vstring inputFile() const { return _inputFile.actualValue; }
   int activationLimit() const { return _activationLimit.actualValue; }
+  unsigned activationBatch() const { return _activationBatch.actualValue; }
   int randomSeed() const { return _randomSeed.actualValue; }
   int rowVariableMaxLength() const { return _rowVariableMaxLength.actualValue; }
   //void setRowVariableMaxLength(int newVal) { _rowVariableMaxLength = newVal; }
@@ -1921,7 +1926,10 @@ public:
   bool bfnt() const { return _bfnt.actualValue; }
   void setBfnt(bool newVal) { _bfnt.actualValue = newVal; }
   URResolution unitResultingResolution() const { return _unitResultingResolution.actualValue; }
+  unsigned unitResultingResolutionLimit() const { return _unitResultingResolutionLimit.actualValue; }
   bool hyperSuperposition() const { return _hyperSuperposition.actualValue; }
+  unsigned hyperSuperpositionRewriterLimit() const { return _hyperSuperpositionRewriterLimit.actualValue; }
+  unsigned hyperSuperpositionCandidateLimit() const { return _hyperSuperpositionCandidateLimit.actualValue; }
   bool innerRewriting() const { return _innerRewriting.actualValue; }
   bool equationalTautologyRemoval() const { return _equationalTautologyRemoval.actualValue; }
   bool arityCheck() const { return _arityCheck.actualValue; }
@@ -1999,6 +2007,9 @@ public:
   RuleActivity generalSplitting() const { return _generalSplitting.actualValue; }
   vstring namePrefix() const { return _namePrefix.actualValue; }
   bool timeStatistics() const { return _timeStatistics.actualValue; }
+  unsigned statisticsSnapshotInterval() const { return _statisticsSnapshotInterval.actualValue; }
+  unsigned statisticsSnapshotActivations() const { return _statisticsSnapshotActivations.actualValue; }
+  vstring statisticsSnapshotFile() const { return _statisticsSnapshotFile.actualValue; }
   bool splitting() const { return _splitting.actualValue; }
   void setSplitting(bool value){ _splitting.actualValue=value; }
   bool nonliteralsInClauseWeight() const { return _nonliteralsInClauseWeight.actualValue; }
@@ -2014,6 +2025,7 @@ public:
   bool colorUnblocking() const { return _colorUnblocking.actualValue; }
 
   Instantiation instantiation() const { return _instantiation.actualValue; }
+  unsigned instantiationCandidateLimit() const { return _instantiationCandidateLimit.actualValue; }
   bool theoryFlattening() const { return _theoryFlattening.actualValue; }
 
   Induction induction() const { return _induction.actualValue; }
@@ -2273,6 +2285,8 @@ private:
   UnsignedOptionValue _guessTheGoalLimit;
 
   BoolOptionValue _hyperSuperposition;
+  UnsignedOptionValue _hyperSuperpositionRewriterLimit;
+  UnsignedOptionValue _hyperSuperpositionCandidateLimit;
 
   BoolOptionValue _innerRewriting;
   BoolOptionValue _equationalTautologyRemoval;
@@ -2289,6 +2303,7 @@ private:
   IntOptionValue _inequalitySplitting;
   ChoiceOptionValue<InputSyntax> _inputSyntax;
   ChoiceOptionValue<Instantiation> _instantiation;
+  UnsignedOptionValue _instantiationCandidateLimit;
   FloatOptionValue _instGenBigRestartRatio;
   BoolOptionValue _instGenPassiveReactivation;
   RatioOptionValue _instGenResolutionInstGenRatio;
@@ -2351,6 +2366,7 @@ private:
   IntOptionValue _rowVariableMaxLength;
 
   IntOptionValue _activationLimit;
+  UnsignedOptionValue _activationBatch;
 
   FloatOptionValue _satClauseActivityDecay;
   ChoiceOptionValue<SatClauseDisposer> _satClauseDisposer;
@@ -2440,8 +2456,12 @@ private:
   /** Time limit in deciseconds */
   TimeLimitOptionValue _timeLimitInDeciseconds;
   BoolOptionValue _timeStatistics;
+  UnsignedOptionValue _statisticsSnapshotInterval;
+  UnsignedOptionValue _statisticsSnapshotActivations;
+  StringOptionValue _statisticsSnapshotFile;
 
   ChoiceOptionValue<URResolution> _unitResultingResolution;
+  UnsignedOptionValue _unitResultingResolutionLimit;
   BoolOptionValue _unusedPredicateDefinitionRemoval;
   BoolOptionValue _blockedClauseElimination;
   UnsignedOptionValue _updatesByOneConstraint;
@@ -399,6 +399,73 @@ void Statistics::print(ostream& out)
   }
 }
 
+/**
+ * Print the current values of the counters, the memory usage and the
+ * times measured by time counters as a single line of JSON.
+ */
+void Statistics::printSnapshot(ostream& out)
+{
+  CALL("Statistics::printSnapshot");
+
+  SaturationAlgorithm::tryUpdateFinalClauseCount();
+
+#define JSON_OUT(name, num) out << ",\"" << (name) << "\":" << (num);
+
+  out << "{\"time\":" << env.timer->elapsedMilliseconds();
+  JSON_OUT("memory", Allocator::getUsedMemory());
+  out << ",\"phase\":\"" << phaseToString(phase) << '"';
+
+  JSON_OUT("generated_clauses", generatedClauses);
+  JSON_OUT("activations", activeClauses);
+  JSON_OUT("passive_additions", passiveClauses);
+  JSON_OUT("current_active", finalActiveClauses);
+  JSON_OUT("current_passive", finalPassiveClauses);
+  JSON_OUT("extensionality_clauses", extensionalityClauses);
+  JSON_OUT("discarded_non_redundant", discardedNonRedundantClauses);
+
+  JSON_OUT("duplicate_literals", duplicateLiterals);
+  JSON_OUT("trivial_inequalities", trivialInequalities);
+  JSON_OUT("fw_subsumption_resolution", forwardSubsumptionResolution);
+  JSON_OUT("bw_subsumption_resolution", backwardSubsumptionResolution);
+  JSON_OUT("fw_demodulations", forwardDemodulations);
+  JSON_OUT("bw_demodulations", backwardDemodulations);
+  JSON_OUT("fw_literal_rewrites", forwardLiteralRewrites);
+  JSON_OUT("inner_rewrites", innerRewrites);
+  JSON_OUT("condensations", condensations);
+  JSON_OUT("global_subsumptions", globalSubsumption);
+  JSON_OUT("evaluations", evaluations);
+
+  JSON_OUT("simple_tautologies", simpleTautologies);
+  JSON_OUT("equational_tautologies", equationalTautologies);
+  JSON_OUT("fw_subsumed", forwardSubsumed);
+  JSON_OUT("bw_subsumed", backwardSubsumed);
+  JSON_OUT("fw_demodulations_to_eq_taut", forwardDemodulationsToEqTaut);
+  JSON_OUT("bw_demodulations_to_eq_taut", backwardDemodulationsToEqTaut);
+
+  JSON_OUT("resolution", resolution);
+  JSON_OUT("ur_resolution", urResolution);
+  JSON_OUT("factoring", factoring);
+  JSON_OUT("fw_superposition", forwardSuperposition);
+  JSON_OUT("bw_superposition", backwardSuperposition);
+  JSON_OUT("self_superposition", selfSuperposition);
+  JSON_OUT("equality_factoring", equalityFactoring);
+  JSON_OUT("equality_resolution", equalityResolution);
+  JSON_OUT("fw_extensionality_resolution", forwardExtensionalityResolution);
+  JSON_OUT("bw_extensionality_resolution", backwardExtensionalityResolution);
+  JSON_OUT("induction", induction);
+
+  JSON_OUT("split_clauses", splitClauses);
+  JSON_OUT("split_components", splitComponents);
+  JSON_OUT("unique_components", uniqueComponents);
+  JSON_OUT("sat_split_refutations", satSplitRefutations);
+
+  out << ",\"time_counters\":";
+  TimeCounter::printSnapshot(out);
+  out << "}" << endl;
+
+#undef JSON_OUT
+}
+
 const char* Statistics::phaseToString(ExecutionPhase p)
 {
   switch(p) {
@@ -63,6 +63,7 @@ public:
   Statistics();
 
   void print(ostream& out);
+  void printSnapshot(ostream& out);
 
   // Input
   /** number of input clauses */
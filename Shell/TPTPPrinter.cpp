@@ -59,11 +59,9 @@ void TPTPPrinter::print(Unit* u)
 {
   CALL("TPTPPrinter::print");
 
-  vstring body = getBodyStr(u);
-
   beginOutput();
   ensureHeadersPrinted(u);
-  printTffWrapper(u, body);
+  printTffWrapper(u);
   endOutput();
 }
 
@@ -75,27 +73,23 @@ void TPTPPrinter::print(Unit* u)
 void TPTPPrinter::printAsClaim(vstring name, Unit* u)
 {
   CALL("TPTPPrinter::printAsClaim");
-  vstring body = getBodyStr(u);
-
   beginOutput();
 
   ensureHeadersPrinted(u);
 
-  tgt() << "tff(" << name << ", claim, " << body << ")." << endl;
+  tgt() << "tff(" << name << ", claim, ";
+  outputBody(tgt(), u);
+  tgt() << ")." << endl;
 
   endOutput();
 }
 
 /**
- * Return as a vstring the body of the Unit u
- * @param u
- * @return the body vstring
+ * Write the body of the Unit u to @c res
  */
-vstring TPTPPrinter::getBodyStr(Unit* u)
+void TPTPPrinter::outputBody(ostream& res, Unit* u)
 {
-  CALL("TPTPPrinter::getBodyStr");
-
-  vostringstream res;
+  CALL("TPTPPrinter::outputBody");
 
   typedef DHMap<unsigned,unsigned> SortMap;
   static SortMap varSorts;
@@ -148,17 +142,15 @@ vstring TPTPPrinter::getBodyStr(Unit* u)
     }
   }
   else {
-    return static_cast<FormulaUnit*>(u)->formula()->toString();
+    res << static_cast<FormulaUnit*>(u)->formula()->toString();
   }
-  return res.str();
 }
 
 /**
  * Surround by tff() the body of the unit u
  * @param u
- * @param bodyStr
  */
-void TPTPPrinter::printTffWrapper(Unit* u, vstring bodyStr)
+void TPTPPrinter::printTffWrapper(Unit* u)
 {
   CALL("TPTPPrinter::printTffWrapper");
 
@@ -187,7 +179,9 @@ void TPTPPrinter::printTffWrapper(Unit* u, vstring bodyStr)
   default:
      ASSERTION_VIOLATION;
   }
-  tgt() << ", " << endl << "    " << bodyStr << " )." << endl;
+  tgt() << ", \n    ";
+  outputBody(tgt(), u);
+  tgt() << " ).\n";
 }
 
 /**
@@ -358,13 +352,26 @@ void TPTPPrinter::endOutput()
 vstring TPTPPrinter::toString(const Formula* formula)
 {
   CALL("TPTPPrinter::toString(const Formula*)");
+
+  vostringstream res;
+  output(res, formula);
+  return res.str();
+}
+
+/**
+ * Write the formula f in TPTP syntax to @c out.
+ *
+ * The formula is written piece by piece as it is traversed, so no string
+ * for the whole formula (or any of its subformulas) is built.
+ */
+void TPTPPrinter::output(ostream& out, const Formula* formula)
+{
+  CALL("TPTPPrinter::output(ostream&,const Formula*)");
   static vstring names [] =
     { "", " & ", " | ", " => ", " <=> ", " <~> ",
       "~", "!", "?", "$term", "$false", "$true", "", ""};
   ASS_EQ(sizeof(names)/sizeof(vstring), NOCONN+1);
 
-  vstring res;
-
   // render a connective if specified, and then a Formula (or ")" of formula is nullptr)
   typedef pair<Connective,const Formula*> Todo;
   Stack<Todo> stack;
@@ -375,12 +382,12 @@ vstring TPTPPrinter::toString(const Formula* formula)
     Todo todo = stack.pop();
 
     // in any case start by rendering the connective passed from "above"
-    res += names[todo.first];
+    out << names[todo.first];
 
     const Formula* f = todo.second;
 
     if (!f) {
-      res += ")";
+      out << ')';
       continue;
     }
 
@@ -388,11 +395,10 @@ vstring TPTPPrinter::toString(const Formula* formula)
 
     switch (c) {
     case LITERAL: {
-      vstring result = f->literal()->toString();
       if (f->literal()->isEquality()) {
-        res += "(" + result + ")";
+        out << '(' << f->literal()->toString() << ')';
       } else {
-        res += result;
+        out << f->literal()->toString();
       }
       continue;
     }
@@ -403,7 +409,7 @@ vstring TPTPPrinter::toString(const Formula* formula)
         // but that should not matter
 
         const FormulaList* fs = f->args();
-        res += "(";
+        out << '(';
         stack.push(make_pair(NOCONN,nullptr)); // render the final closing bracket
         while (FormulaList::isNonEmpty(fs)) {
           const Formula* arg = fs->head();
@@ -419,7 +425,7 @@ vstring TPTPPrinter::toString(const Formula* formula)
     case XOR:
       // here we can afford to keep the order right
 
-      res += "(";
+      out << '(';
 
       stack.push(make_pair(NOCONN,nullptr)); // render the final closing bracket
 
@@ -430,7 +436,7 @@ vstring TPTPPrinter::toString(const Formula* formula)
       continue;
 
     case NOT:
-      res += "(";
+      out << '(';
 
       stack.push(make_pair(NOCONN,nullptr)); // render the final closing bracket
 
@@ -441,7 +447,7 @@ vstring TPTPPrinter::toString(const Formula* formula)
     case FORALL:
     case EXISTS:
       {
-        vstring result = vstring("(") + names[c] + "[";
+        out << '(' << names[c] << '[';
         bool needsComma = false;
         Formula::VarList::Iterator vs(f->vars());
         Formula::SortList::Iterator ss(f->sorts());
@@ -451,24 +457,23 @@ vstring TPTPPrinter::toString(const Formula* formula)
           int var = vs.next();
 
           if (needsComma) {
-            result += ", ";
+            out << ", ";
           }
-          result += 'X';
-          result += Int::toString(var);
+          out << 'X' << var;
           unsigned t;
           if (hasSorts) {
             ASS(ss.hasNext());
             t = ss.next();
             if (t != Sorts::SRT_DEFAULT) {
-              result += " : " + env.sorts->sortName(t);
+              out << " : " << env.sorts->sortName(t);
             }
           } else if (SortHelper::tryGetVariableSort(var, const_cast<Formula*>(f),
               t) && t != Sorts::SRT_DEFAULT) {
-            result += " : " + env.sorts->sortName(t);
+            out << " : " << env.sorts->sortName(t);
           }
           needsComma = true;
         }
-        res += result + "] : (";
+        out << "] : (";
 
         stack.push(make_pair(NOCONN,nullptr));
         stack.push(make_pair(NOCONN,nullptr)); // here we close two brackets
@@ -479,20 +484,19 @@ vstring TPTPPrinter::toString(const Formula* formula)
       }
 
     case BOOL_TERM:
-      res += f->getBooleanTerm().toString();
+      out << f->getBooleanTerm().toString();
 
       continue;
 
     case FALSE:
     case TRUE:
-      res += names[c];
+      out << names[c];
 
       continue;
     default:
       ASSERTION_VIOLATION;
     }
   }
-  return res;
 }
 
 /**
@@ -506,14 +510,24 @@ vstring TPTPPrinter::toString(const Formula* formula)
 vstring TPTPPrinter::toString (const Unit* unit)
 {
   CALL("TPTPPrinter::toString(const Unit*)");
+
+  vostringstream res;
+  output(res, unit);
+  return res.str();
+}
+
+/**
+ * Write unit @param unit in TPTP format to @c out, in the same form
+ * as returned by toString(const Unit*)
+ */
+void TPTPPrinter::output(ostream& out, const Unit* unit)
+{
+  CALL("TPTPPrinter::output(ostream&,const Unit*)");
 //  const Inference* inf = unit->inference();
 //  Inference::Rule rule = inf->rule();
 
-  vstring prefix;
-  vstring main = "";
-
   bool negate_formula = false;
-  vstring kind;
+  const char* kind;
   switch (unit->inputType()) {
   case Unit::ASSUMPTION:
     kind = "hypothesis";
@@ -542,22 +556,41 @@ vstring TPTPPrinter::toString (const Unit* unit)
     break;
   }
 
+  out << (unit->isClause() ? "cnf(" : "tff(");
+  vstring unitName;
+  if(Parse::TPTP::findAxiomName(unit, unitName)) {
+    out << unitName;
+  }
+  else {
+    out << 'u' << unit->number();
+  }
+  out << ',' << kind << ",\n    ";
+
   if (unit->isClause()) {
-    prefix = "cnf";
-    main = static_cast<const Clause*>(unit)->toTPTPString();
+    // the same as Clause::toTPTPString(), but without joining the literals
+    const Clause* cl = static_cast<const Clause*>(unit);
+    unsigned len = cl->length();
+    if (!len) {
+      out << "$false";
+    }
+    for (unsigned i = 0; i < len; i++) {
+      if (i) {
+        out << " | ";
+      }
+      out << (*cl)[i]->toString();
+    }
   }
   else {
-    prefix = "tff";
     const Formula* f = static_cast<const FormulaUnit*>(unit)->formula();
     if(negate_formula) {
       Formula* quant=Formula::quantify(const_cast<Formula*>(f));
       if(quant->connective()==NOT) {
 	ASS_EQ(quant, f);
-	main = toString(quant->uarg());
+	output(out, quant->uarg());
       }
       else {
 	Formula* neg=new NegatedFormula(quant);
-	main = toString(neg);
+	output(out, neg);
 	neg->destroy();
       }
       if(quant!=f) {
@@ -567,17 +600,11 @@ vstring TPTPPrinter::toString (const Unit* unit)
       }
     }
     else {
-      main = toString(f);
+      output(out, f);
     }
   }
 
-  vstring unitName;
-  if(!Parse::TPTP::findAxiomName(unit, unitName)) {
-    unitName="u" + Int::toString(unit->number());
-  }
-
-  return prefix + "(" + unitName + "," + kind + ",\n"
-    + "    " + main + ").\n";
+  out << ").\n";
 }
 
 
@@ -48,18 +48,20 @@ public:
 
   static vstring toString(const Unit*);
   static vstring toString(const Formula*);
+  static void output(ostream& out, const Unit*);
+  static void output(ostream& out, const Formula*);
   static vstring toString(const Term*);
   static vstring toString(const Literal*);
 
 private:
 
-  vstring getBodyStr(Unit* u);
+  void outputBody(ostream& out, Unit* u);
 
   void ensureHeadersPrinted(Unit* u);
   void outputSymbolTypeDefinitions(unsigned symNumber, bool function);
 
   void ensureNecesarySorts();
-  void printTffWrapper(Unit* u, vstring bodyStr);
+  void printTffWrapper(Unit* u);
 
   void beginOutput();
   void endOutput();
@@ -58,7 +58,9 @@ void TheoryAxioms::addAndOutputTheoryUnit(Unit* unit, unsigned level)
   static Options::TheoryAxiomLevel opt_level = env.options->theoryAxioms();
   // if the theory axioms are some or off (want this case for some things like fool) and the axiom is not
   // a cheap one then don't add it
-  if(opt_level != Options::TheoryAxiomLevel::ON && level != CHEAP){ return; }
+  if(opt_level != Options::TheoryAxiomLevel::ON && opt_level != Options::TheoryAxiomLevel::LAZY && level != CHEAP){
+    return;
+  }
 
 
   if (env.options->showTheoryAxioms()) {
@@ -185,7 +185,10 @@ void UIHelper::outputSaturatedSet(ostream& out, UnitIterator uit)
 
   while (uit.hasNext()) {
     Unit* cl = uit.next();
-    out << TPTPPrinter::toString(cl) << endl;
+    // units are written straight into the stream, which is flushed
+    // only once the whole set has been output
+    TPTPPrinter::output(out, cl);
+    out << '\n';
   }
 
   addCommentSignForSZS(out);
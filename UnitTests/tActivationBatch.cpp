@@ -0,0 +1,97 @@
+
+/*
+ * File tActivationBatch.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+/**
+ * @file tActivationBatch.cpp
+ * Unit test of the main loop selecting several given clauses in one
+ * step (--activation_batch above 1)
+ */
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID activationBatch
+UT_CREATE;
+
+#include "Lib/Environment.hpp"
+#include "Lib/VString.hpp"
+
+#include "Kernel/Problem.hpp"
+
+#include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
+
+#include "Saturation/ProvingHelper.hpp"
+
+#include "Parse/TPTP.hpp"
+
+using namespace Lib;
+using namespace Kernel;
+using namespace Saturation;
+using namespace Shell;
+
+/** Set the options of the test back to their defaults when it ends, even by a failed check */
+struct ActivationOptionsRestorer
+{
+  ~ActivationOptionsRestorer()
+  {
+    env.options->set("activation_batch","1");
+    env.options->set("activation_limit","0");
+  }
+};
+
+static void run(vstring prob)
+{
+  vistringstream inp(prob);
+  UnitList* units=Parse::TPTP::parse(inp);
+
+  Problem prb(units);
+  ProvingHelper::runVampire(prb, *env.options);
+}
+
+TEST_FUN(activationBatchRefutation)
+{
+  ActivationOptionsRestorer restorer;
+  env.options->set("activation_batch","3");
+
+  unsigned active0=env.statistics->activeClauses;
+  run("fof(a,axiom,p(a)). fof(b,axiom,![X]:(p(X)=>q(X))). fof(c,conjecture,q(a)).");
+
+  ASS_EQ(env.statistics->terminationReason,Statistics::REFUTATION);
+  ASS_G(env.statistics->activeClauses,active0);
+}
+
+TEST_FUN(activationBatchLimit)
+{
+  ActivationOptionsRestorer restorer;
+  //never saturates, p(f(...f(a)...)) keeps being derived
+  vstring prob="fof(a,axiom,p(a)). fof(b,axiom,![X]:(p(X)=>p(f(X)))). fof(c,conjecture,q).";
+
+  //with single given clauses, the limit bounds the number of activations
+  env.options->set("activation_limit","3");
+  unsigned active0=env.statistics->activeClauses;
+  run(prob);
+  ASS_EQ(env.statistics->terminationReason,Statistics::ACTIVATION_LIMIT);
+  unsigned single=env.statistics->activeClauses-active0;
+  ASS_LE(single,4);
+
+  //with batches, it bounds the number of batches, so more clauses get activated
+  env.options->set("activation_batch","4");
+  active0=env.statistics->activeClauses;
+  run(prob);
+  ASS_EQ(env.statistics->terminationReason,Statistics::ACTIVATION_LIMIT);
+  ASS_G(env.statistics->activeClauses-active0,single);
+}
@@ -0,0 +1,98 @@
+
+/*
+ * File tClauseContainer.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+
+#include "Lib/Stack.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+
+#include "Indexing/Index.hpp"
+
+#include "Saturation/ClauseContainer.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID clauseContainer
+UT_CREATE;
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+using namespace Indexing;
+using namespace Saturation;
+
+static Stack<unsigned> notified;
+
+class RecordingIndex : public Index
+{
+public:
+  RecordingIndex(unsigned id) : _id(id) {}
+protected:
+  void handleClause(Clause* c, bool adding)
+  {
+    notified.push(_id);
+  }
+private:
+  unsigned _id;
+};
+
+TEST_FUN(clauseContainerDetachKeepsOrder)
+{
+  PlainClauseContainer cont;
+  RecordingIndex* idx[5];
+  for(unsigned i=0;i<5;i++) {
+    idx[i] = new RecordingIndex(i);
+    idx[i]->attachContainer(&cont);
+  }
+
+  Clause* cl = new(0) Clause(0,Unit::AXIOM,new Inference(Inference::INPUT));
+
+  // most recently attached first
+  notified.reset();
+  cont.add(cl);
+  ASS_EQ(notified.size(),5);
+  for(unsigned i=0;i<5;i++) {
+    ASS_EQ(notified[i],4-i);
+  }
+
+  // detaching from the middle must not reorder the others
+  delete idx[1];
+  notified.reset();
+  cont.add(cl);
+  ASS_EQ(notified.size(),4);
+  ASS_EQ(notified[0],4);
+  ASS_EQ(notified[1],3);
+  ASS_EQ(notified[2],2);
+  ASS_EQ(notified[3],0);
+
+  delete idx[4];
+  delete idx[0];
+  notified.reset();
+  cont.add(cl);
+  ASS_EQ(notified.size(),2);
+  ASS_EQ(notified[0],3);
+  ASS_EQ(notified[1],2);
+
+  delete idx[2];
+  delete idx[3];
+  notified.reset();
+  cont.add(cl);
+  ASS(notified.isEmpty());
+
+  cl->destroy();
+}
@@ -0,0 +1,53 @@
+
+/*
+ * File tInlineStack.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+
+#include "Lib/InlineStack.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID inlineStack
+UT_CREATE;
+
+using namespace std;
+using namespace Lib;
+
+TEST_FUN(inlineStackSpill)
+{
+  InlineStack<size_t,4> st;
+
+  size_t cnt=100;
+  for(size_t i=0;i<cnt;i++) {
+    st.push(i);
+    ASS_EQ(st.top(),i);
+  }
+  ASS_EQ(st.size(),cnt);
+
+  InlineStack<size_t,4> copy(st);
+  for(size_t i=cnt;i>0;i--) {
+    ASS_EQ(st.pop(),i-1);
+  }
+  ASS(st.isEmpty());
+  ASS_EQ(copy.size(),cnt);
+
+  st.push(7);
+  copy=st;
+  ASS_EQ(copy.size(),1);
+  ASS_EQ(copy.pop(),7);
+  ASS(copy.isEmpty());
+}
@@ -0,0 +1,134 @@
+
+/*
+ * File tLazyTheoryAxioms.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+/**
+ * @file tLazyTheoryAxioms.cpp
+ * Unit test checking that theory axioms held back by --theory_axioms lazy
+ * reach the proof search once a clause using their symbols is activated,
+ * and only then
+ */
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID lazyTheoryAxioms
+UT_CREATE;
+
+#include "Lib/Environment.hpp"
+#include "Lib/VString.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/Problem.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/Sorts.hpp"
+#include "Kernel/Term.hpp"
+#include "Kernel/Theory.hpp"
+
+#include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
+
+#include "Saturation/LazyTheoryAxioms.hpp"
+#include "Saturation/ProvingHelper.hpp"
+
+#include "Parse/TPTP.hpp"
+
+using namespace Lib;
+using namespace Kernel;
+using namespace Saturation;
+using namespace Shell;
+
+/** Set theory_axioms back to its default when the test ends, even by a failed check */
+struct TheoryAxiomsRestorer
+{
+  ~TheoryAxiomsRestorer() { env.options->set("theory_axioms","on"); }
+};
+
+TEST_FUN(lazyTheoryAxioms1)
+{
+  //provable only with the $sum/$less ordering axioms
+  vstring prob="tff(c,conjecture, ! [X:$int] : $less(X,$sum(X,1))).";
+
+  vistringstream inp(prob);
+  UnitList* units=Parse::TPTP::parse(inp);
+
+  TheoryAxiomsRestorer restorer;
+  env.options->set("theory_axioms","lazy");
+
+  Problem prb(units);
+  ProvingHelper::runVampire(prb, *env.options);
+
+  ASS_EQ(env.statistics->terminationReason,Statistics::REFUTATION);
+}
+
+static Clause* unitClause(Literal* lit)
+{
+  Clause* cl = new(1) Clause(1,Unit::AXIOM,new Inference(Inference::THEORY));
+  (*cl)[0] = lit;
+  return cl;
+}
+
+static TermList binary(Interpretation itp, TermList a1, TermList a2)
+{
+  return TermList(Term::create2(env.signature->getInterpretingSymbol(itp),a1,a2));
+}
+
+TEST_FUN(lazyTheoryAxioms2)
+{
+  TermList x(0,false);
+  TermList y(1,false);
+  TermList one(theory->representConstant(IntegerConstantType("1")));
+  unsigned less = env.signature->getInterpretingSymbol(Theory::INT_LESS);
+
+  Clause* sumAx = unitClause(Literal::createEquality(true,
+      binary(Theory::INT_PLUS,x,y),binary(Theory::INT_PLUS,y,x),Sorts::SRT_INTEGER));
+  Clause* lessAx = unitClause(Literal::create2(less,false,x,x));
+  Clause* productAx = unitClause(Literal::createEquality(true,
+      binary(Theory::INT_MULTIPLY,x,y),binary(Theory::INT_MULTIPLY,y,x),Sorts::SRT_INTEGER));
+
+  LazyTheoryAxioms* store = new LazyTheoryAxioms();
+  ASS(store->add(sumAx));
+  ASS(store->add(lessAx));
+  ASS(store->add(productAx));
+  ASS_EQ(store->size(),3);
+
+  //an activated clause with $less and $sum, but no $product
+  Clause* given = unitClause(Literal::create2(less,true,one,binary(Theory::INT_PLUS,one,one)));
+
+  ClauseStack released;
+  store->release(given,released);
+  ASS_EQ(released.size(),2);
+  ASS(released.find(sumAx));
+  ASS(released.find(lessAx));
+  ASS_EQ(store->size(),1);
+
+  //released axioms are not released again
+  ClauseStack again;
+  store->release(given,again);
+  ASS(again.isEmpty());
+  ASS_EQ(store->size(),1);
+
+  while(released.isNonEmpty()) {
+    released.pop()->decRefCnt();
+  }
+  //the $product axiom is still pending and goes with the store
+  delete store;
+
+  sumAx->destroy();
+  lessAx->destroy();
+  given->destroy();
+}
@@ -0,0 +1,165 @@
+
+/*
+ * File tProblemScopes.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+/**
+ * @file tProblemScopes.cpp
+ * Test for the assertion scopes of Api::Problem
+ */
+
+#include "Api/FormulaBuilder.hpp"
+#include "Api/Problem.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID problem_scopes
+UT_CREATE;
+
+using namespace std;
+using namespace Api;
+
+static AnnotatedFormula axiom(FormulaBuilder& fb, Lib::vstring name)
+{
+  return fb.annotatedFormula(fb.formula(fb.predicate(name,0)), FormulaBuilder::AXIOM, name);
+}
+
+/** Number of formulas in @b prb called @b name */
+static unsigned occurrences(Problem& prb, Lib::vstring name)
+{
+  unsigned res=0;
+  AnnotatedFormulaIterator fit=prb.formulas();
+  while(fit.hasNext()) {
+    if(fit.next().name()==name) {
+      res++;
+    }
+  }
+  return res;
+}
+
+TEST_FUN(scopesNested)
+{
+  FormulaBuilder fb;
+  Problem prb;
+
+  prb.addFormula(axiom(fb,"a"));
+  ASS_EQ(prb.scopeDepth(),0);
+
+  prb.push();
+  prb.addFormula(axiom(fb,"b"));
+  ASS_EQ(prb.scopeDepth(),1);
+
+  prb.push();
+  prb.addFormula(axiom(fb,"c"));
+  prb.addFormula(axiom(fb,"d"));
+  ASS_EQ(prb.scopeDepth(),2);
+  ASS_EQ(prb.size(),4);
+
+  prb.pop();
+  ASS_EQ(prb.scopeDepth(),1);
+  ASS_EQ(prb.size(),2);
+  ASS_EQ(occurrences(prb,"c"),0);
+  ASS_EQ(occurrences(prb,"d"),0);
+  ASS_EQ(occurrences(prb,"b"),1);
+
+  //an empty scope
+  prb.push();
+  prb.pop();
+  ASS_EQ(prb.scopeDepth(),1);
+  ASS_EQ(prb.size(),2);
+
+  prb.pop();
+  ASS_EQ(prb.scopeDepth(),0);
+  ASS_EQ(prb.size(),1);
+  ASS_EQ(occurrences(prb,"a"),1);
+}
+
+TEST_FUN(scopesRepeatedFormula)
+{
+  FormulaBuilder fb;
+  Problem prb;
+
+  //only the occurrence added inside the scope goes away
+  AnnotatedFormula a=axiom(fb,"a");
+  prb.addFormula(a);
+  prb.push();
+  prb.addFormula(a);
+  ASS_EQ(occurrences(prb,"a"),2);
+  prb.pop();
+  ASS_EQ(occurrences(prb,"a"),1);
+  ASS_EQ(prb.size(),1);
+}
+
+TEST_FUN(scopesPopWithoutPush)
+{
+  FormulaBuilder fb;
+  Problem prb;
+  prb.addFormula(axiom(fb,"a"));
+
+  //popping without pushing should throw exception
+  try {
+    prb.pop();
+    ASSERTION_VIOLATION;
+  }
+  catch(ApiException&) {}
+  ASS_EQ(prb.scopeDepth(),0);
+  ASS_EQ(occurrences(prb,"a"),1);
+
+  //and so should popping more than was pushed
+  prb.push();
+  prb.pop();
+  try {
+    prb.pop();
+    ASSERTION_VIOLATION;
+  }
+  catch(ApiException&) {}
+  ASS_EQ(prb.scopeDepth(),0);
+}
+
+TEST_FUN(scopesRemovedFormula)
+{
+  FormulaBuilder fb;
+  Problem prb;
+
+  AnnotatedFormula a=axiom(fb,"a");
+  prb.addFormula(a);
+  prb.push();
+  prb.addFormula(axiom(fb,"b"));
+  prb.push();
+  prb.addFormula(a);
+  prb.addFormula(axiom(fb,"c"));
+
+  //remove the newest occurrence of a, added in the inner scope
+  AnnotatedFormulaIterator fit=prb.formulas();
+  while(fit.hasNext()) {
+    if(fit.next().name()=="a") {
+      fit.del();
+      break;
+    }
+  }
+  ASS_EQ(occurrences(prb,"a"),1);
+
+  //as documented, pop() then removes the older occurrence in its place
+  prb.pop();
+  ASS_EQ(prb.scopeDepth(),1);
+  ASS_EQ(occurrences(prb,"a"),0);
+  ASS_EQ(occurrences(prb,"c"),0);
+  ASS_EQ(occurrences(prb,"b"),1);
+
+  //the outer scope is not affected by the inner one
+  prb.pop();
+  ASS_EQ(prb.scopeDepth(),0);
+  ASS_EQ(occurrences(prb,"b"),0);
+}
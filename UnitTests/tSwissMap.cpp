@@ -0,0 +1,141 @@
+
+/*
+ * File tSwissMap.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ *
+ * In summary, you are allowed to use Vampire for non-commercial
+ * purposes but not allowed to distribute, modify, copy, create derivatives,
+ * or use in competitions. 
+ * For other uses of Vampire please contact developers for a different
+ * licence, which we will make an effort to provide. 
+ */
+
+#include "Lib/SwissMap.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID swissmap
+UT_CREATE;
+
+using namespace std;
+using namespace Lib;
+
+class ConstHash {
+public:
+  static unsigned hash(unsigned i)
+  {
+    return 1;
+  }
+};
+
+typedef SwissMap<unsigned, unsigned> MyMap;
+
+TEST_FUN(swissmap1)
+{
+  MyMap m1;
+  m1.insert(1,1);
+  m1.insert(2,4);
+  m1.insert(3,9);
+  m1.insert(5,25);
+
+  NEVER(m1.insert(5,0));
+  ASS_EQ(m1.get(5),25);
+  NEVER(m1.set(5,26));
+  ASS_EQ(m1.get(5),26);
+
+  MyMap::Iterator mit(m1);
+  unsigned seen=0;
+  while(mit.hasNext())
+  {
+    unsigned k=mit.nextKey();
+    ALWAYS(m1.find(k));
+    seen++;
+  }
+  ASS_EQ(seen,4);
+  ASS(!m1.find(4));
+
+  m1.reset();
+  ASS(m1.isEmpty());
+  MyMap::Iterator mit2(m1);
+  ASS(!mit2.hasNext());
+
+  unsigned cnt=10000;
+  for(unsigned i=0;i<cnt;i++) {
+    m1.insert(i,i*i);
+  }
+  ASS_EQ(m1.size(),cnt);
+  for(unsigned i=0;i<cnt;i++) {
+    unsigned v;
+    ALWAYS(m1.find(i,v));
+    ASS_EQ(v,i*i);
+  }
+  ASS(!m1.find(cnt));
+
+  for(unsigned i=1;i<cnt;i+=2) {
+    ALWAYS(m1.remove(i));
+  }
+  NEVER(m1.remove(cnt+1));
+  ASS_EQ(m1.size(), cnt/2+cnt%2);
+  for(unsigned i=0;i<cnt;i++) {
+    unsigned v;
+    bool res=m1.find(i,v);
+    ASS(res==(i%2==0));
+    ASS(!res||v==i*i);
+  }
+}
+
+/**
+ * With a constant hash all keys form a single probe run, so removals
+ * have to shift entries back across groups and around the end of the table
+ */
+TEST_FUN(swissmap2)
+{
+  SwissMap<unsigned, unsigned, ConstHash> m;
+
+  unsigned cnt=100;
+  for(unsigned round=0;round<3;round++) {
+    for(unsigned i=0;i<cnt;i++) {
+      ALWAYS(m.insert(i,i+round));
+    }
+    for(unsigned i=0;i<cnt;i+=3) {
+      ALWAYS(m.remove(i));
+    }
+    for(unsigned i=0;i<cnt;i++) {
+      unsigned v;
+      bool res=m.find(i,v);
+      ASS(res==(i%3!=0));
+      ASS(!res||v==i+round);
+    }
+    m.reset();
+    ASS(m.isEmpty());
+  }
+}
+
+TEST_FUN(swissset1)
+{
+  SwissSet<unsigned> s;
+
+  for(unsigned i=0;i<1000;i++) {
+    ALWAYS(s.insert(i*7));
+  }
+  NEVER(s.insert(7));
+  ASS_EQ(s.size(),1000);
+  ALWAYS(s.remove(7));
+  ASS(!s.find(7));
+  ASS(s.find(14));
+
+  unsigned seen=0;
+  SwissSet<unsigned>::Iterator it(s);
+  while(it.hasNext()) {
+    ASS_EQ(it.next()%7,0);
+    seen++;
+  }
+  ASS_EQ(seen,999);
+}
@@ -35,24 +35,27 @@
 namespace VUtils
 {
 
+/**
+ * Concatenate SMT-LIB 1 benchmarks given on the command line into a
+ * single SMT-LIB 2 problem written to the standard output.
+ *
+ * Benchmarks are processed one attribute at a time and every declaration
+ * and assertion is written as soon as it has been read, so only the set
+ * of declared function names is kept in memory.
+ */
 int SMTLIBConcat::perform(int argc, char** argv)
 {
   CALL("SMTLIBConcat::perform");
 
-  Stack<LExpr*> benchExprs;
+  DHSet<vstring> funSet;
 
   for(int i=2; i<argc; i++) {
-    LExpr* bench = parseFile(argv[i]);
-    benchExprs.push(bench);
+    streamBenchmark(argv[i], funSet, cout);
   }
 
-  LExpr* merged = mergeBenchmarksIntoSmtlib2(benchExprs);
-
-  rewriteIntsToReals(merged);
-
-//  LExpr* converted = smtlibToSmtlib2(merged);
-
-  cout << merged->toString(false) << endl;
+  emit((LispListWriter() << "check-sat").get(), cout);
+  emit((LispListWriter() << "get-proof").get(), cout);
+  cout.flush();
 
   return 0;
 }
@@ -179,105 +182,183 @@ void SMTLIBConcat::rewriteIntsToReals(LExpr* e0)
   }
 }
 
-void SMTLIBConcat::addBenchmark(LExpr* expr, DHSet<vstring>& funSet, LispListWriter& wrt)
+/**
+ * Rewrite @c e, write it to @c out as one top-level expression and
+ * release it.
+ */
+void SMTLIBConcat::emit(LExpr* e, ostream& out)
 {
-  CALL("SMTLIBConcat::readBenchmark");
+  CALL("SMTLIBConcat::emit");
 
-  ASS_REP(expr->isList(), expr->toString());
+  rewriteIntsToReals(e);
+  out << e->toString() << '\n';
+  destroyExpr(e);
+}
 
-  LispListReader tlRdr(expr->list);
-  LExprList* benchLst = tlRdr.readList();
-  tlRdr.acceptEOL();
+/**
+ * Read the benchmark in file @c fname and write its declarations and
+ * assertions to @c out. Functions whose names are already in @c funSet
+ * are not declared again.
+ *
+ * The benchmark is not parsed as a whole: the header is read token by
+ * token and each attribute value is parsed, written and released before
+ * the next one is read.
+ */
+void SMTLIBConcat::streamBenchmark(vstring fname, DHSet<vstring>& funSet, ostream& out)
+{
+  CALL("SMTLIBConcat::streamBenchmark");
 
-  LispListReader bRdr(benchLst);
-  bRdr.acceptAtom("benchmark");
-  bRdr.acceptAtom(); //benchmark name
-  while(bRdr.hasNext()) {
-    if(bRdr.tryAcceptAtom(":status")) {
-      bRdr.acceptAtom();
+  if(!System::fileExists(fname)) {
+    USER_ERROR("input file does not exist: "+fname);
+  }
+
+  static char buf[1<<16];
+  ifstream fin;
+  fin.rdbuf()->pubsetbuf(buf, sizeof(buf));
+  fin.open(fname.c_str());
+  LispLexer lex(fin);
+
+  Token tok;
+  lex.readToken(tok);
+  if(tok.tag!=TT_LPAR) {
+    USER_ERROR("benchmark expected in "+fname);
+  }
+  lex.readToken(tok);
+  if(tok.tag!=TT_NAME || tok.text!="benchmark") {
+    USER_ERROR("benchmark expected in "+fname);
+  }
+  lex.readToken(tok); //benchmark name
+  if(tok.tag!=TT_NAME) {
+    USER_ERROR("benchmark name expected in "+fname);
+  }
+
+  for(;;) {
+    lex.readToken(tok);
+    if(tok.tag==TT_RPAR) {
+      break;
     }
-    else if(bRdr.tryAcceptAtom(":source")) {
-      if(!bRdr.tryAcceptCurlyBrackets()) {
-	bRdr.acceptAtom();
-      }
+    if(tok.tag!=TT_NAME) {
+      USER_ERROR("benchmark attribute expected in "+fname+", got: "+tok.text);
+    }
+    vstring attr = tok.text;
+
+    lex.readToken(tok);
+    LExpr* val = readExpr(lex, tok);
+
+    if(attr==":status" || attr==":source") {
+      //the value of :source is a single curly-bracketed token
     }
-    else if(bRdr.tryAcceptAtom(":extrafuns")) {
-      LExprList* funDecls = bRdr.readList();
-      LExprList::Iterator funIt(funDecls);
+    else if(attr==":extrafuns") {
+      if(!val->isList()) { USER_ERROR("list of function declarations expected: "+val->toString()); }
+      LExprList::Iterator funIt(val->list);
       while(funIt.hasNext()) {
 	LExpr* funDecl = funIt.next();
-	if(!funDecl->isList() && funDecl->list->head()->isAtom()) { USER_ERROR("function declaration expected: "+funDecl->toString()); }
+	if(!funDecl->isList() || !funDecl->list || !funDecl->list->head()->isAtom()) {
+	  USER_ERROR("function declaration expected: "+funDecl->toString());
+	}
 
 	vstring fnName = funDecl->list->head()->str;
 	if(!funSet.insert(fnName)) {
 	  //duplicate function
 	  continue;
 	}
-	wrt << extrafuns2decl(funDecl);
+	emit(extrafuns2decl(funDecl), out);
       }
     }
-    else if(bRdr.tryAcceptAtom(":formula")) {
-      LExpr* form = bRdr.readNext();
-      rewriteSmt1FormToSmt2(form);
-      wrt << (LispListWriter() << "assert" << form);
+    else if(attr==":formula") {
+      rewriteSmt1FormToSmt2(val);
+      LExpr* form = val;
+      val = 0;
+      emit((LispListWriter() << "assert" << form).get(), out);
     }
     else {
-      //this will always give an error as we have bRdr.hasNext() set to true
-      bRdr.acceptEOL();
+      USER_ERROR("unsupported benchmark attribute "+attr+" in "+fname);
+    }
+    if(val) {
+      destroyExpr(val);
     }
   }
+
+  lex.readToken(tok);
+  if(tok.tag!=TT_EOF) {
+    USER_ERROR("a single benchmark expected in "+fname);
+  }
 }
 
-LExpr* SMTLIBConcat::mergeBenchmarksIntoSmtlib2(Stack<LExpr*>& exprs)
+/**
+ * Read one s-expression whose first token is @c tok from @c lex
+ */
+LExpr* SMTLIBConcat::readExpr(LispLexer& lex, Token& tok)
 {
-  CALL("SMTLIBConcat::mergeBenchmarks");
-
-  DHSet<vstring> funSet;
-  Stack<LExpr*> funs;
-
-  LispListWriter res;
-  Stack<LExpr*>::Iterator bit(exprs);
-  while(bit.hasNext()) {
-    LExpr* benchExpr = bit.next();
-    addBenchmark(benchExpr, funSet, res);
+  CALL("SMTLIBConcat::readExpr");
+
+  switch(tok.tag) {
+  case TT_NAME:
+  case TT_INTEGER:
+  case TT_REAL:
+    return new LExpr(LispParser::ATOM, tok.text);
+  case TT_LPAR:
+    break;
+  default:
+    USER_ERROR("s-expression expected, got: "+tok.text);
   }
 
-//  LispListWriter resBench;
-//  resBench << "benchmark" << "unnamed" << ":status" << "unknown";
-//
-//  Stack<LExpr*>::Iterator funIt(funs);
-//  while(funIt.hasNext()) {
-//    LExpr* funDecl = funIt.next();
-//    resBench << ":extrafuns";
-//    resBench << (LispListWriter()<<funDecl);
-//  }
-//
-//  LispListWriter form;
-//  form << "and";
-//  form.append(formulas);
-//
-//  resBench << ":formula" << form;
-
-  res << (LispListWriter() << "check-sat");
-  res << (LispListWriter() << "get-proof");
-
-  return res.get();
+  LExpr* res = new LExpr(LispParser::LIST);
+  //for each open list, the place where its next element is to be linked
+  static Stack<LExprList**> ends;
+  ends.reset();
+  ends.push(&res->list);
+
+  while(ends.isNonEmpty()) {
+    lex.readToken(tok);
+    LExpr* el;
+    switch(tok.tag) {
+    case TT_RPAR:
+      ends.pop();
+      continue;
+    case TT_LPAR:
+      el = new LExpr(LispParser::LIST);
+      break;
+    case TT_NAME:
+    case TT_INTEGER:
+    case TT_REAL:
+      el = new LExpr(LispParser::ATOM, tok.text);
+      break;
+    case TT_EOF:
+      USER_ERROR("unmatched left parenthesis");
+    default:
+      USER_ERROR("unexpected token: "+tok.text);
+    }
+    LExprList** end = ends.top();
+    *end = new LExprList(el);
+    ends.setTop((*end)->tailPtr());
+    if(el->isList()) {
+      ends.push(&el->list);
+    }
+  }
+  return res;
 }
 
-LExpr* SMTLIBConcat::parseFile(vstring fname)
+/**
+ * Release @c e together with all its subexpressions
+ */
+void SMTLIBConcat::destroyExpr(LExpr* e)
 {
-  CALL("SMTLIBConcat::parseFile");
+  CALL("SMTLIBConcat::destroyExpr");
 
-  if(!System::fileExists(fname)) {
-    USER_ERROR("input file does not exist: "+fname);
+  Stack<LExpr*> toDo;
+  toDo.push(e);
+  while(toDo.isNonEmpty()) {
+    LExpr* curr = toDo.pop();
+    if(curr->isList()) {
+      LExprList::Iterator elit(curr->list);
+      while(elit.hasNext()) {
+	toDo.push(elit.next());
+      }
+      LExprList::destroy(curr->list);
+    }
+    delete curr;
   }
-
-  ifstream fin(fname.c_str());
-  LispLexer lex(fin);
-  LispParser parser(lex);
-  LExpr* res = parser.parse();
-
-  return res;
 }
 
 }
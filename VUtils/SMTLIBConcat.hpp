@@ -26,7 +26,10 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/VString.hpp"
+
 #include "Shell/LispParser.hpp"
+#include "Shell/Token.hpp"
 
 namespace VUtils {
 
@@ -44,12 +47,12 @@ private:
   void rewriteSmt1FormToSmt2(LExpr* e);
 //  LExpr* smtlibToSmtlib2(LExpr* e);
 
-  void addBenchmark(LExpr* expr, DHSet<vstring>& funSet, LispListWriter& wrt);
+  void streamBenchmark(vstring fname, DHSet<vstring>& funSet, ostream& out);
+  void emit(LExpr* e, ostream& out);
 
-  LExpr* parseFile(vstring fname);
-  LExpr* mergeBenchmarksIntoSmtlib2(Stack<LExpr*>& exprs);
+  static LExpr* readExpr(LispLexer& lex, Token& tok);
+  static void destroyExpr(LExpr* e);
 };
-
 }
 
 #endif // __SMTLIBConcat__
@@ -47,6 +47,7 @@
 #include "Lib/Metaiterators.hpp"
 
 #include "Lib/RCPtr.hpp"
+#include "Lib/Sys/Multiprocessing.hpp"
 
 
 #include "Kernel/Clause.hpp"
@@ -615,6 +616,149 @@ void vampireMode()
   }
 } // vampireMode
 
+/**
+ * Children of the daemon mode exit with this value plus the termination
+ * reason, so that their exit codes cannot be confused with the codes
+ * used for exceptions, signals and the time limit
+ */
+#define DAEMON_STATUS_BASE 16
+
+/**
+ * Return the name under which daemon mode reports the exit code
+ * @b resValue of a child that solved one request.
+ */
+const char* daemonStatusName(int resValue)
+{
+  if(resValue < DAEMON_STATUS_BASE) {
+    return "error";
+  }
+  switch(resValue - DAEMON_STATUS_BASE) {
+  case Statistics::REFUTATION:
+  case Statistics::SAT_UNSATISFIABLE:
+    return "refutation";
+  case Statistics::SATISFIABLE:
+  case Statistics::SAT_SATISFIABLE:
+    return "satisfiable";
+  case Statistics::REFUTATION_NOT_FOUND:
+    return "refutation_not_found";
+  case Statistics::INAPPROPRIATE:
+    return "inappropriate";
+  case Statistics::UNKNOWN:
+    return "unknown";
+  case Statistics::TIME_LIMIT:
+    return "time_limit";
+  case Statistics::MEMORY_LIMIT:
+    return "memory_limit";
+  case Statistics::ACTIVATION_LIMIT:
+    return "activation_limit";
+  default:
+    return "error";
+  }
+}
+
+/**
+ * Serve proof requests read from the standard input.
+ *
+ * Each line is a problem file name, optionally followed by a space and
+ * an option string in the name=value:name=value format. A line "exit"
+ * or the end of the input terminates the mode. Every request is solved
+ * in a child forked from this process, so the command line, the options
+ * and the global structures are initialised only once. The child prints
+ * its usual output and the parent then prints a reply line
+ *
+ *   % daemon reply id=N status=S time=T problem=P
+ *
+ * where S is the termination reason, or "error" if the request failed,
+ * and T the wall-clock time in milliseconds.
+ */
+void daemonMode()
+{
+  CALL("daemonMode()");
+
+  // every request should be solved with the options given on the command line
+  env.options->setMode(Options::Mode::VAMPIRE);
+  // the time limit applies to the individual requests, not to the daemon
+  Timer::setTimeLimitEnforcement(false);
+
+  unsigned requestCnt = 0;
+  vstring line;
+  while (getline(cin, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    if (line == "exit") {
+      break;
+    }
+    requestCnt++;
+
+    vstring problemFile = line;
+    vstring optionString;
+    size_t sep = line.find(' ');
+    if (sep != vstring::npos) {
+      problemFile = line.substr(0, sep);
+      optionString = line.substr(sep+1);
+    }
+    if (problemFile.empty()) {
+      // the child would read the problem from the standard input
+      env.beginOutput();
+      env.out() << "% daemon reply id=" << requestCnt
+                << " status=error time=0 problem=" << endl << flush;
+      env.endOutput();
+      continue;
+    }
+
+    env.beginOutput();
+    env.out() << flush;
+    env.endOutput();
+
+    int startTime = env.timer->elapsedMilliseconds();
+    pid_t child = Multiprocessing::instance()->fork();
+    if (!child) {
+      System::registerForSIGHUPOnParentDeath();
+
+      env.timer->reset();
+      env.timer->start();
+      TimeCounter::reinitialize();
+      Timer::setTimeLimitEnforcement(true);
+
+      int resValue = VAMP_RESULT_STATUS_UNHANDLED_EXCEPTION;
+      try {
+        env.options->setInputFile(problemFile);
+        if (!optionString.empty()) {
+          env.options->readOptionsString(optionString);
+        }
+        env.options->checkGlobalOptionConstraints();
+        Allocator::setMemoryLimit(env.options->memoryLimit() * 1048576ul);
+
+        vampireMode();
+        resValue = DAEMON_STATUS_BASE + env.statistics->terminationReason;
+      } catch (Exception& exception) {
+        env.beginOutput();
+        explainException(exception);
+        env.endOutput();
+      }
+      // exit() would flush and close the standard input shared with the
+      // parent, moving its read position back
+      env.beginOutput();
+      env.out() << flush;
+      env.endOutput();
+      System::terminateImmediately(resValue);
+    }
+
+    int resValue;
+    Multiprocessing::instance()->waitForParticularChildTermination(child, resValue);
+    Timer::syncClock();
+
+    env.beginOutput();
+    env.out() << "% daemon reply id=" << requestCnt
+              << " status=" << daemonStatusName(resValue)
+              << " time=" << (env.timer->elapsedMilliseconds() - startTime)
+              << " problem=" << problemFile << endl << flush;
+    env.endOutput();
+  }
+  vampireReturnValue = VAMP_RESULT_STATUS_SUCCESS;
+} // daemonMode
+
 void spiderMode()
 {
   CALL("spiderMode()");
@@ -871,6 +1015,9 @@ int main(int argc, char* argv[])
     case Options::Mode::SPIDER:
       spiderMode();
       break;
+    case Options::Mode::DAEMON:
+      daemonMode();
+      break;
     case Options::Mode::RANDOM_STRATEGY:
       getRandomStrategy();
       break;
@@ -21,9 +21,12 @@
  */
 
 #include <iostream>
+#include <fstream>
 
 #include "Debug/Tracer.hpp"
 
+#include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Exception.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Int.hpp"
@@ -38,6 +41,7 @@
 #include "Lib/Vector.hpp"
 #include "Lib/System.hpp"
 #include "Lib/Metaiterators.hpp"
+#include "Lib/Sys/Multiprocessing.hpp"
 
 #include "Kernel/Clause.hpp"
 #include "Kernel/Formula.hpp"
@@ -56,7 +60,7 @@
 #include "Shell/Property.hpp"
 #include "Shell/Preprocess.hpp"
 #include "Shell/Statistics.hpp"
-#include "Shell/TPTP.hpp"
+#include "Shell/TPTPPrinter.hpp"
 #include "Shell/UIHelper.hpp"
 
 #include "Saturation/SaturationAlgorithm.hpp"
@@ -65,6 +69,7 @@ using namespace Shell;
 using namespace SAT;
 using namespace Saturation;
 using namespace Inferences;
+using namespace Lib::Sys;
 
 UnitList* globUnitList=0;
 Problem* globProblem=0;
@@ -102,36 +107,51 @@ Problem* getPreprocessedProblem()
   return prb;
 }
 
-void clausifyMode()
+/**
+ * Write the clauses of the preprocessed problem @b prb to @b out in TPTP
+ * and return the number of written clauses.
+ */
+unsigned outputClauses(Problem& prb, ostream& out)
 {
-  CALL("clausifyMode()");
+  CALL("outputClauses");
 
   CompositeISE simplifier;
   simplifier.addFront(new TrivialInequalitiesRemovalISE());
   simplifier.addFront(new TautologyDeletionISE());
   simplifier.addFront(new DuplicateLiteralRemovalISE());
 
-  ScopedPtr<Problem> prb(getPreprocessedProblem());
-
-  env.beginOutput();
-  UIHelper::outputSymbolDeclarations(env.out());
+  UIHelper::outputSortDeclarations(out);
+  UIHelper::outputSymbolDeclarations(out);
 
-  ClauseIterator cit = prb->clauseIterator();
+  unsigned cnt = 0;
+  ClauseIterator cit = prb.clauseIterator();
   while (cit.hasNext()) {
     Clause* cl=cit.next();
     cl=simplifier.simplify(cl);
     if(!cl) {
       continue;
     }
-    env.out() << TPTP::toString(cl) << "\n";
+    TPTPPrinter::output(out, cl);
+    out << '\n';
+    cnt++;
   }
+  return cnt;
+} // outputClauses
+
+void clausifyMode()
+{
+  CALL("clausifyMode()");
+
+  ScopedPtr<Problem> prb(getPreprocessedProblem());
+
+  env.beginOutput();
+  outputClauses(*prb, env.out());
   env.endOutput();
 
   //we have successfully output all clauses, so we'll terminate with zero return value
   vampireReturnValue = VAMP_RESULT_STATUS_SUCCESS;
 } // clausifyMode
 
-
 void explainException (Exception& exception)
 {
   env.beginOutput();
@@ -139,6 +159,141 @@ void explainException (Exception& exception)
   env.endOutput();
 } // explainException
 
+/**
+ * Clausify one problem of a batch in a child process and terminate.
+ *
+ * The clauses are written to @b outFile and a line with the number of
+ * clauses and the time is printed.
+ */
+void clausifyBatchProblem(const vstring& problem, const vstring& outFile)
+{
+  CALL("clausifyBatchProblem");
+
+  System::registerForSIGHUPOnParentDeath();
+  env.timer->reset();
+  env.timer->start();
+  TimeCounter::reinitialize();
+  Timer::setTimeLimitEnforcement(true);
+
+  int resValue = 1;
+  try {
+    env.options->setInputFile(problem);
+    ScopedPtr<Problem> prb(getPreprocessedProblem());
+
+    static char buffer[1<<16];
+    ofstream out;
+    out.rdbuf()->pubsetbuf(buffer, sizeof(buffer));
+    out.open(outFile.c_str());
+    unsigned cnt = outputClauses(*prb, out);
+    out.close();
+
+    env.beginOutput();
+    env.out() << "% " << problem << " status=ok clauses=" << cnt
+              << " time=" << env.timer->elapsedMilliseconds() << endl;
+    env.endOutput();
+    resValue = 0;
+  }
+  catch (Exception& exception) {
+    explainException(exception);
+  }
+  // a forked child must not run the exit handlers of the parent
+  env.beginOutput();
+  env.out() << flush;
+  env.endOutput();
+  System::terminateImmediately(resValue);
+} // clausifyBatchProblem
+
+/**
+ * Clausify all problems in the directory @b input (recursively) or, if
+ * @b input is not a directory, all problems listed in the file @b input,
+ * one per line. At most @b workers problems are clausified at the same
+ * time, each in its own child process. If @b workers is zero, the number
+ * of cores is used.
+ */
+void clausifyBatch(const vstring& input, const vstring& outputDir, unsigned workers)
+{
+  CALL("clausifyBatch");
+
+  Stack<vstring> problems;
+  System::readDir(input, problems);
+  if (problems.isEmpty()) {
+    ifstream list(input.c_str());
+    if (list.fail()) {
+      USER_ERROR("Cannot open problem list "+input);
+    }
+    vstring line;
+    while (getline(list, line)) {
+      if (!line.empty()) {
+        problems.push(line);
+      }
+    }
+  }
+  if (!workers) {
+    workers = System::getNumberOfCores();
+  }
+
+  // problems are written under their file names, which must not clash
+  // (problems in different subdirectories may share one)
+  Stack<vstring> outFiles;
+  DHMap<vstring, unsigned> outNames;
+  for (unsigned i = 0; i < problems.size(); i++) {
+    vstring name = System::extractFileNameFromPath(problems[i]);
+    unsigned prev;
+    if (outNames.find(name, prev)) {
+      USER_ERROR("Problems "+problems[prev]+" and "+problems[i]+" would both be written to "+outputDir+"/"+name);
+    }
+    outNames.insert(name, i);
+    outFiles.push(outputDir + "/" + name);
+  }
+
+  // the time limit applies to the individual problems
+  Timer::setTimeLimitEnforcement(false);
+
+  DHMap<pid_t, unsigned> running;
+  DArray<int> startTimes(problems.size());
+  unsigned next = 0;
+  unsigned failed = 0;
+  int batchStart = env.timer->elapsedMilliseconds();
+
+  while (next < problems.size() || running.size()) {
+    if (next < problems.size() && running.size() < workers) {
+      env.beginOutput();
+      env.out() << flush;
+      env.endOutput();
+
+      pid_t child = Multiprocessing::instance()->fork();
+      if (!child) {
+        clausifyBatchProblem(problems[next], outFiles[next]);
+      }
+      startTimes[next] = env.timer->elapsedMilliseconds();
+      running.insert(child, next);
+      next++;
+      continue;
+    }
+
+    int resValue;
+    pid_t finished = Multiprocessing::instance()->waitForChildTermination(resValue);
+    Timer::syncClock();
+    unsigned idx = running.get(finished);
+    running.remove(finished);
+    if (resValue) {
+      failed++;
+      env.beginOutput();
+      env.out() << "% " << problems[idx] << " status=failed"
+                << " time=" << (env.timer->elapsedMilliseconds() - startTimes[idx]) << endl;
+      env.endOutput();
+    }
+  }
+
+  env.beginOutput();
+  env.out() << "% clausified " << (problems.size() - failed) << " of " << problems.size()
+            << " problems in " << (env.timer->elapsedMilliseconds() - batchStart) << " ms" << endl;
+  env.endOutput();
+
+  vampireReturnValue = failed ? 1 : VAMP_RESULT_STATUS_SUCCESS;
+} // clausifyBatch
+
+
 /**
  * The main function.
   * @since 03/12/2003 many changes related to logging
@@ -155,23 +310,42 @@ int main(int argc, char* argv [])
   Lib::Random::setSeed(123456);
 
   try {
-    env.options->setMode(Options::MODE_CLAUSIFY);
+    env.options->setMode(Options::Mode::CLAUSIFY);
+
+    // vclausify --batch <directory or problem list> <output directory> <workers> [options]
+    bool batch = argc >= 5 && vstring(argv[1]) == "--batch";
+    vstring batchInput;
+    vstring batchOutputDir;
+    unsigned batchWorkers = 0;
+    if (batch) {
+      batchInput = argv[2];
+      batchOutputDir = argv[3];
+      if (!Int::stringToUnsignedInt(argv[4], batchWorkers)) {
+        USER_ERROR("The number of workers must be a non-negative integer");
+      }
+      // let the command line parser see only the options
+      argv[4] = argv[0];
+      argv += 4;
+      argc -= 4;
+    }
 
     // read the command line and interpret it
     Shell::CommandLine cl(argc,argv);
     cl.interpret(*env.options);
 
-    PROCESS_TRACE_SPEC_STRING(env.options->traceSpecString());
-    env.options->enableTracesAccordingToOptions();
-
-    if(env.options->mode()!=Options::MODE_CLAUSIFY) {
+    if(env.options->mode()!=Options::Mode::CLAUSIFY) {
       USER_ERROR("Only the \"clausify\" mode is supported");
     }
 
     Allocator::setMemoryLimit(env.options->memoryLimit()*1048576ul);
     Lib::Random::setSeed(env.options->randomSeed());
 
-    clausifyMode();
+    if (batch) {
+      clausifyBatch(batchInput, batchOutputDir, batchWorkers);
+    }
+    else {
+      clausifyMode();
+    }
 
   }
 #if VDEBUG